@@ -104,7 +104,8 @@ function App() {
     reset,
     restoreState,
     getFreeBlocks,
-    getAllocatedBlocks
+    getAllocatedBlocks,
+    getUsage
   } = useMemoryManager();
 
   // UI State
@@ -210,6 +211,7 @@ function App() {
             blocks={blocks}
             osMemory={manager.osMemory}
             totalMemory={manager.totalMemory}
+            getUsage={getUsage}
             zoomLevel={zoomLevel}
             onZoomIn={handleZoomIn}
             onZoomOut={handleZoomOut}
@@ -11,6 +11,7 @@ export function VisualizationArea({
   blocks,
   osMemory,
   totalMemory,
+  getUsage,
   zoomLevel,
   onZoomIn,
   onZoomOut,
@@ -35,6 +36,7 @@ export function VisualizationArea({
         blocks={blocks}
         osMemory={osMemory}
         totalMemory={totalMemory}
+        getUsage={getUsage}
         zoomLevel={zoomLevel}
         onBlockClick={onBlockClick}
       />
@@ -1,18 +1,32 @@
 /**
  * CityViewport Component
  * Container for the city skyline visualization
+ *
+ * Small heaps get one building per block. Past CONFIG.MAX_DRAWN_BLOCKS
+ * blocks the skyline is drawn from getUsage() instead - one column per
+ * address slice, as tall as the slice is full - so the cost depends on
+ * the column count, not the block count. The usage strip under the
+ * skyline always shows the whole address range the same way.
  */
 
 import React from 'react';
 import { MemoryBlockView } from './MemoryBlockView';
+import { CONFIG } from '../../config/constants';
 
 export function CityViewport({ 
   blocks, 
   osMemory, 
   totalMemory, 
+  getUsage,
   zoomLevel = 1,
   onBlockClick 
 }) {
+  const usage = getUsage ? getUsage(osMemory, totalMemory, CONFIG.USAGE_COLUMNS) : null;
+  const drawColumns = usage !== null && usage.length > 0 && blocks.length > CONFIG.MAX_DRAWN_BLOCKS;
+  const columnWidth = usage !== null && usage.length > 0
+    ? ((totalMemory - osMemory) / totalMemory) * (100 / usage.length)
+    : 0;
+
   return (
     <div className="city-viewport">
       <div 
@@ -43,19 +57,39 @@ export function CityViewport({
             </div>
           </div>
 
-          {/* User Memory Blocks */}
-          {blocks.map(block => (
-            <MemoryBlockView
-              key={block.id}
-              block={block}
-              totalMemory={totalMemory}
-              onClick={onBlockClick}
-            />
-          ))}
+          {/* User Memory: one building per block, or usage columns for huge heaps */}
+          {drawColumns
+            ? Array.from(usage, (fill, i) => (
+              <div
+                key={i}
+                className="usage-column"
+                style={{
+                  width: `${columnWidth}%`,
+                  height: `${Math.max(2, (fill / 1000) * 280)}px`
+                }}
+                title={`${fill / 10}% used`}
+              />
+            ))
+            : blocks.map(block => (
+              <MemoryBlockView
+                key={block.id}
+                block={block}
+                totalMemory={totalMemory}
+                onClick={onBlockClick}
+              />
+            ))}
         </div>
 
-        {/* Address Bar */}
-        <div className="address-bar" />
+        {/* Address Bar with the usage strip of user memory */}
+        <div className="address-bar">
+          {usage !== null && (
+            <div className="usage-strip" style={{ marginLeft: `${(osMemory / totalMemory) * 100}%` }}>
+              {Array.from(usage, (fill, i) => (
+                <div key={i} className="usage-cell" style={{ opacity: 0.15 + (fill / 1000) * 0.85 }} />
+              ))}
+            </div>
+          )}
+        </div>
       </div>
     </div>
   );
@@ -12,7 +12,11 @@ export const CONFIG = {
   WINDOW_FLICKER_CHANCE: 0.3,
   PARTICLE_COUNT: 30,
   HIGH_FRAG_THRESHOLD: 30,
-  CRITICAL_FRAG_THRESHOLD: 50
+  CRITICAL_FRAG_THRESHOLD: 50,
+  KEYFRAME_INTERVAL: 32,  // Timeline: full block snapshot every N delta events
+  USAGE_COLUMNS: 128,     // Columns of the usage strip under the skyline
+  MAX_DRAWN_BLOCKS: 200,  // More blocks than this: draw usage columns instead
+  ENGINE: 'wasm'          // 'wasm' = C core when built (npm run build:wasm), 'js' = JS model
 };
 
 export const ALGORITHM_NAMES = {
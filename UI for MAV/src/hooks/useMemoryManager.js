@@ -3,14 +3,30 @@
  * React hook wrapper for MemoryManager to trigger re-renders on state changes
  */
 
-import { useState, useCallback } from 'react';
+import { useState, useCallback, useEffect } from 'react';
 import { MemoryManager } from '../models/MemoryManager';
+import { WasmMemoryManager, loadWasmCore } from '../models/WasmMemoryManager';
 import { CONFIG } from '../config/constants';
 
 export function useMemoryManager() {
-  const [manager] = useState(() => new MemoryManager(CONFIG.HEAP_SIZE, CONFIG.OS_MEMORY));
+  const [manager, setManager] = useState(() => new MemoryManager(CONFIG.HEAP_SIZE, CONFIG.OS_MEMORY));
   const [, forceUpdate] = useState(0);
 
+  // Switch to the C core once its WebAssembly build has loaded,
+  // unless the user already started working with the JS model
+  useEffect(() => {
+    if (CONFIG.ENGINE !== 'wasm') return undefined;
+
+    let cancelled = false;
+    loadWasmCore().then(core => {
+      if (!core || cancelled) return;
+      setManager(current => (current.history.length > 1
+        ? current
+        : new WasmMemoryManager(core, CONFIG.HEAP_SIZE, CONFIG.OS_MEMORY)));
+    });
+    return () => { cancelled = true; };
+  }, []);
+
   const refresh = useCallback(() => {
     forceUpdate(n => n + 1);
   }, []);
@@ -40,6 +56,7 @@ export function useMemoryManager() {
 
   return {
     manager,
+    engine: manager.engine,
     blocks: manager.blocks,
     history: manager.history,
     stats: manager.getStats(),
@@ -47,6 +64,10 @@ export function useMemoryManager() {
     deallocate,
     reset,
     restoreState,
+    // Rebuild blocks at any timeline step (nearest keyframe + deltas)
+    getStateAt: (index) => manager.getStateAt(index),
+    // Fill level per column of an address range (both engines)
+    getUsage: (from, to, columns) => manager.getUsage(from, to, columns),
     getFreeBlocks: () => manager.getFreeBlocks(),
     getAllocatedBlocks: () => manager.getAllocatedBlocks(),
     firstFit: (size) => manager.firstFit(size),
@@ -8,11 +8,14 @@ import { CONFIG } from '../config/constants';
 
 export class MemoryManager {
   constructor(totalMem = CONFIG.HEAP_SIZE, osMem = CONFIG.OS_MEMORY) {
+    this.engine = 'js';
     this.totalMemory = totalMem;
     this.osMemory = osMem;
     this.userMemory = totalMem - osMem;
     this.blocks = [];
     this.history = [];
+    this.events = [];
+    this.keyframes = [];
     this.processCounter = 0;
     this.blockIdCounter = 0;
     this.totalAllocations = 0;
@@ -55,6 +58,39 @@ export class MemoryManager {
     return ((fragmentedMemory / this.userMemory) * 100).toFixed(1);
   }
 
+  // Fill level (0-1000) of each of `columns` equal slices of [from, to),
+  // the OS region counting as used - same interface as the wasm engine.
+  // One sweep over the blocks: O(blocks + columns)
+  getUsage(from, to, columns) {
+    if (from < 0 || to > this.totalMemory || from >= to || columns <= 0) {
+      return new Int32Array(0);
+    }
+
+    const count = Math.min(columns, to - from);
+    const usage = new Int32Array(count);
+    const span = to - from;
+    let b = 0;
+
+    for (let c = 0; c < count; c++) {
+      const lo = from + Math.floor((span * c) / count);
+      const hi = from + Math.floor((span * (c + 1)) / count);
+      let used = Math.max(0, Math.min(hi, this.osMemory) - lo);
+
+      // Skip blocks that end before this slice, then add the overlaps
+      while (b < this.blocks.length && this.blocks[b].startAddress + this.blocks[b].size <= lo) {
+        b++;
+      }
+      for (let i = b; i < this.blocks.length && this.blocks[i].startAddress < hi; i++) {
+        const block = this.blocks[i];
+        if (block.isAllocated) {
+          used += Math.min(hi, block.startAddress + block.size) - Math.max(lo, block.startAddress);
+        }
+      }
+      usage[c] = Math.floor((used * 1000) / (hi - lo));
+    }
+    return usage;
+  }
+
   // Get statistics
   getStats() {
     const freeBlocks = this.getFreeBlocks();
@@ -158,33 +194,15 @@ export class MemoryManager {
       return { success: false, message: 'No suitable hole found (fragmentation)' };
     }
     
-    const blockIndex = this.blocks.indexOf(targetBlock);
     const processId = processName || `P${++this.processCounter}`;
     
-    if (targetBlock.size === size) {
-      // Perfect fit - just mark as allocated
-      targetBlock.isAllocated = true;
-      targetBlock.processId = processId;
-    } else {
-      // Split the block
-      const allocatedBlock = new MemoryBlock(
-        this.blockIdCounter++,
-        targetBlock.startAddress,
-        size,
-        processId,
-        true
-      );
-      
-      const remainingBlock = new MemoryBlock(
-        this.blockIdCounter++,
-        targetBlock.startAddress + size,
-        targetBlock.size - size,
-        null,
-        false
-      );
-      
-      this.blocks.splice(blockIndex, 1, allocatedBlock, remainingBlock);
+    const startAddress = targetBlock.startAddress;
+
+    // Split off the remainder first, then bind the exact-size block
+    if (targetBlock.size > size) {
+      this.emit({ type: 'split', at: startAddress + size, id: this.blockIdCounter++ });
     }
+    this.emit({ type: 'bind', at: startAddress, processId });
     
     this.totalAllocations++;
     this.saveState(`Allocated ${processId} (${size} KB) using ${algorithm}`);
@@ -194,7 +212,7 @@ export class MemoryManager {
       processId, 
       size, 
       algorithm,
-      startAddress: targetBlock.startAddress
+      startAddress
     };
   }
 
@@ -207,11 +225,17 @@ export class MemoryManager {
     }
     
     const block = this.blocks[blockIndex];
-    block.isAllocated = false;
-    block.processId = null;
+    this.emit({ type: 'release', at: block.startAddress, processId });
     
-    // Merge adjacent free blocks (MATCHES C CODE LOGIC)
-    this.mergeAdjacentFreeBlocks();
+    // Merge with next, then previous free neighbour (MATCHES C CODE LOGIC)
+    const next = this.blocks[blockIndex + 1];
+    if (next && !next.isAllocated) {
+      this.emit({ type: 'merge', at: block.startAddress, with: next.startAddress });
+    }
+    const prev = this.blocks[blockIndex - 1];
+    if (prev && !prev.isAllocated) {
+      this.emit({ type: 'merge', at: prev.startAddress, with: block.startAddress });
+    }
     
     this.totalDeallocations++;
     this.saveState(`Deallocated ${processId}`);
@@ -221,31 +245,106 @@ export class MemoryManager {
 
   // Merge adjacent free blocks (MATCHES C CODE)
   mergeAdjacentFreeBlocks() {
-    let merged = true;
-    
-    while (merged) {
-      merged = false;
-      for (let i = 0; i < this.blocks.length - 1; i++) {
-        const current = this.blocks[i];
-        const next = this.blocks[i + 1];
-        
-        if (!current.isAllocated && !next.isAllocated) {
-          current.size += next.size;
-          this.blocks.splice(i + 1, 1);
-          merged = true;
-          break;
-        }
+    for (let i = this.blocks.length - 2; i >= 0; i--) {
+      if (!this.blocks[i].isAllocated && !this.blocks[i + 1].isAllocated) {
+        this.emit({ type: 'merge', at: this.blocks[i].startAddress, with: this.blocks[i + 1].startAddress });
       }
     }
   }
 
-  // Save current state to history
+  // Binary search for the index of the block containing an address
+  static indexOfAddress(blocks, address) {
+    let low = 0;
+    let high = blocks.length - 1;
+    while (low < high) {
+      const mid = (low + high + 1) >> 1;
+      if (blocks[mid].startAddress <= address) low = mid;
+      else high = mid - 1;
+    }
+    return low;
+  }
+
+  // Apply one delta event to a block array (used live and during replay)
+  static applyEvent(blocks, event) {
+    const index = MemoryManager.indexOfAddress(blocks, event.at);
+    const block = blocks[index];
+
+    switch (event.type) {
+      case 'split': {
+        const tailSize = block.startAddress + block.size - event.at;
+        block.size -= tailSize;
+        blocks.splice(index + 1, 0, new MemoryBlock(event.id, event.at, tailSize, null, false));
+        break;
+      }
+      case 'merge': {
+        block.size += blocks[index + 1].size;
+        blocks.splice(index + 1, 1);
+        break;
+      }
+      case 'bind':
+        block.isAllocated = true;
+        block.processId = event.processId;
+        break;
+      case 'release':
+        block.isAllocated = false;
+        block.processId = null;
+        break;
+      default:
+        break;
+    }
+  }
+
+  // Record a delta, apply it, and drop a keyframe every KEYFRAME_INTERVAL events
+  emit(event) {
+    const lastKeyframe = this.keyframes[this.keyframes.length - 1];
+    if (this.events.length - lastKeyframe.eventIndex >= CONFIG.KEYFRAME_INTERVAL) {
+      this.saveKeyframe();
+    }
+    this.events.push(event);
+    MemoryManager.applyEvent(this.blocks, event);
+  }
+
+  saveKeyframe() {
+    this.keyframes.push({
+      eventIndex: this.events.length,
+      blocks: this.blocks.map(b => b.clone())
+    });
+  }
+
+  // Rebuild the block list as it was after `eventIndex` events:
+  // seek to the nearest keyframe, then apply deltas forward
+  rebuildAt(eventIndex) {
+    let low = 0;
+    let high = this.keyframes.length - 1;
+    while (low < high) {
+      const mid = (low + high + 1) >> 1;
+      if (this.keyframes[mid].eventIndex <= eventIndex) low = mid;
+      else high = mid - 1;
+    }
+
+    const keyframe = this.keyframes[low];
+    const blocks = keyframe.blocks.map(b => b.clone());
+    for (let i = keyframe.eventIndex; i < eventIndex; i++) {
+      MemoryManager.applyEvent(blocks, this.events[i]);
+    }
+    return blocks;
+  }
+
+  // Blocks as they were after history entry `index` (does not change state)
+  getStateAt(index) {
+    if (index < 0 || index >= this.history.length) return null;
+    return this.rebuildAt(this.history[index].eventIndex);
+  }
+
+  // Save current state to history (only a pointer into the event log)
   saveState(action) {
+    if (this.keyframes.length === 0) {
+      this.saveKeyframe();
+    }
     this.history.push({
       timestamp: new Date(),
       action,
-      blocks: this.blocks.map(b => b.clone()),
-      stats: this.getStats()
+      eventIndex: this.events.length
     });
   }
 
@@ -253,9 +352,14 @@ export class MemoryManager {
   restoreState(index) {
     if (index < 0 || index >= this.history.length) return false;
     
-    const state = this.history[index];
-    this.blocks = state.blocks.map(b => b.clone());
+    const eventIndex = this.history[index].eventIndex;
+    this.blocks = this.rebuildAt(eventIndex);
     this.history = this.history.slice(0, index + 1);
+    this.events.length = eventIndex;
+    while (this.keyframes.length > 1 &&
+           this.keyframes[this.keyframes.length - 1].eventIndex > eventIndex) {
+      this.keyframes.pop();
+    }
     
     return true;
   }
@@ -270,6 +374,8 @@ export class MemoryManager {
       false
     )];
     this.history = [];
+    this.events = [];
+    this.keyframes = [];
     this.processCounter = 0;
     this.totalAllocations = 0;
     this.totalDeallocations = 0;
@@ -282,10 +388,13 @@ export class MemoryManager {
     const cloned = new MemoryManager(this.totalMemory, this.osMemory);
     cloned.blocks = [];
     cloned.history = [];
+    cloned.events = [];
+    cloned.keyframes = [];
     cloned.processCounter = 0;
     cloned.totalAllocations = 0;
     cloned.totalDeallocations = 0;
     cloned.blocks.push(new MemoryBlock(0, this.osMemory, this.userMemory, null, false));
+    cloned.saveKeyframe();
     return cloned;
   }
 }
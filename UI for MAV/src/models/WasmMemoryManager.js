@@ -0,0 +1,211 @@
+/**
+ * WasmMemoryManager Class
+ * Same interface as MemoryManager, but every allocation, merge and timeline
+ * rewind runs in the C core (src/memory_manager.c) compiled to WebAssembly.
+ * Build the core with `npm run build:wasm`; without it the UI keeps using
+ * the JavaScript model.
+ */
+
+import { MemoryBlock } from './MemoryBlock';
+import { MemoryManager } from './MemoryManager';
+
+const ALGORITHM_CODES = {
+  firstFit: 0,
+  bestFit: 1,
+  worstFit: 2
+};
+
+// Clones made by the comparison modal are dropped without cleanup, so
+// release their C sessions when the JS object is garbage collected
+const sessionRegistry = new FinalizationRegistry(({ core, session }) => {
+  core._mav_destroy(session);
+});
+
+// Load public/wasm/mav_core.js at runtime; resolves to null if it was not built
+export async function loadWasmCore() {
+  try {
+    const url = `${import.meta.env.BASE_URL}wasm/mav_core.js`;
+    const { default: createCore } = await import(/* @vite-ignore */ url);
+    // The C core prints banners and errors; the UI shows its own messages
+    return await createCore({ print: () => {}, printErr: () => {} });
+  } catch {
+    return null;
+  }
+}
+
+export class WasmMemoryManager {
+  constructor(core, totalMem, osMem) {
+    this.core = core;
+    this.engine = 'wasm';
+    this.totalMemory = totalMem;
+    this.osMemory = osMem;
+    this.userMemory = totalMem - osMem;
+    this.session = core._mav_create(totalMem, osMem);
+    sessionRegistry.register(this, { core, session: this.session }, this);
+    this.history = [];
+    this.totalAllocations = 0;
+    this.totalDeallocations = 0;
+
+    // The C core identifies processes by number, the UI by name
+    this.pidByName = new Map();
+    this.nameByPid = [null];
+    this.processCounter = 0;
+
+    this.syncBlocks();
+    this.saveState('Initial State');
+  }
+
+  // Read the C block table straight out of wasm memory
+  readBlockTable(tablePtr) {
+    const count = this.core._mav_block_count(this.session);
+    const table = this.core.HEAP32.subarray(tablePtr >> 2, (tablePtr >> 2) + count * 3);
+    const blocks = new Array(count);
+
+    for (let i = 0; i < count; i++) {
+      const pid = table[i * 3 + 2];
+      blocks[i] = new MemoryBlock(
+        table[i * 3],
+        table[i * 3],
+        table[i * 3 + 1],
+        pid === -1 ? null : this.nameByPid[pid],
+        pid !== -1
+      );
+    }
+    return blocks;
+  }
+
+  syncBlocks() {
+    this.blocks = this.readBlockTable(this.core._mav_block_table(this.session));
+  }
+
+  pidFor(name) {
+    let pid = this.pidByName.get(name);
+    if (pid === undefined) {
+      pid = this.nameByPid.length;
+      this.pidByName.set(name, pid);
+      this.nameByPid.push(name);
+    }
+    return pid;
+  }
+
+  // Fill level (0-1000) of each of `columns` equal slices of [from, to);
+  // cost depends on columns, not blocks, so zoom/pan stays cheap
+  getUsage(from, to, columns) {
+    const ptr = this.core._mav_usage(this.session, from, to, columns);
+    if (!ptr) return new Int32Array(0);
+    const count = this.core._mav_usage_count(this.session);
+    return this.core.HEAP32.slice(ptr >> 2, (ptr >> 2) + count);
+  }
+
+  getFreeBlocks() {
+    return this.blocks.filter(b => !b.isAllocated);
+  }
+
+  getAllocatedBlocks() {
+    return this.blocks.filter(b => b.isAllocated);
+  }
+
+  calculateFragmentation() {
+    return this.core._mav_fragmentation(this.session).toFixed(1);
+  }
+
+  getStats() {
+    return MemoryManager.prototype.getStats.call(this);
+  }
+
+  // Read-only previews used by the inspector (placement itself runs in C)
+  firstFit(size) {
+    return MemoryManager.prototype.firstFit.call(this, size);
+  }
+
+  bestFit(size) {
+    return MemoryManager.prototype.bestFit.call(this, size);
+  }
+
+  worstFit(size) {
+    return MemoryManager.prototype.worstFit.call(this, size);
+  }
+
+  allocate(size, processName, algorithm) {
+    if (size <= 0) {
+      return { success: false, message: 'Invalid process size' };
+    }
+
+    const freeMemory = this.core._mav_free_memory(this.session);
+    if (size > freeMemory) {
+      return { success: false, message: `Not enough free memory (need ${size} KB, have ${freeMemory} KB)` };
+    }
+
+    const processId = processName || `P${++this.processCounter}`;
+    const code = ALGORITHM_CODES[algorithm] ?? ALGORITHM_CODES.firstFit;
+    const startAddress = this.core._mav_allocate(this.session, this.pidFor(processId), size, code);
+
+    if (startAddress === -1) {
+      return { success: false, message: 'No suitable hole found (fragmentation)' };
+    }
+
+    this.syncBlocks();
+    this.totalAllocations++;
+    this.saveState(`Allocated ${processId} (${size} KB) using ${algorithm}`);
+
+    return { success: true, processId, size, algorithm, startAddress };
+  }
+
+  deallocate(processId) {
+    const pid = this.pidByName.get(processId);
+    if (pid === undefined || !this.core._mav_deallocate(this.session, pid)) {
+      return { success: false, message: 'Process not found' };
+    }
+
+    this.syncBlocks();
+    this.totalDeallocations++;
+    this.saveState(`Deallocated ${processId}`);
+
+    return { success: true, processId };
+  }
+
+  // History entries only remember where they are in the C event log
+  saveState(action) {
+    this.history.push({
+      timestamp: new Date(),
+      action,
+      eventIndex: this.core._mav_event_count(this.session)
+    });
+  }
+
+  getStateAt(index) {
+    if (index < 0 || index >= this.history.length) return null;
+    const eventIndex = this.history[index].eventIndex;
+    return this.readBlockTable(this.core._mav_block_table_at(this.session, eventIndex));
+  }
+
+  restoreState(index) {
+    if (index < 0 || index >= this.history.length) return false;
+    if (!this.core._mav_restore(this.session, this.history[index].eventIndex)) return false;
+
+    this.history = this.history.slice(0, index + 1);
+    this.syncBlocks();
+    return true;
+  }
+
+  reset() {
+    this.core._mav_reset(this.session);
+    this.history = [];
+    this.processCounter = 0;
+    this.totalAllocations = 0;
+    this.totalDeallocations = 0;
+    this.syncBlocks();
+    this.saveState('Memory Reset');
+  }
+
+  clone() {
+    return new WasmMemoryManager(this.core, this.totalMemory, this.osMemory);
+  }
+
+  // Free the C session right away instead of waiting for GC
+  destroy() {
+    sessionRegistry.unregister(this);
+    this.core._mav_destroy(this.session);
+    this.session = 0;
+  }
+}
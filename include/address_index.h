@@ -0,0 +1,151 @@
+/*
+================================================================================
+FILE: address_index.h
+PURPOSE: Find blocks by address - "which block holds address X?"
+DESCRIPTION:
+    - The UI, displayMemory() and a debugger ask about addresses, and
+      allocator traces free by address ("free(0x4000)"), not by PID
+    - Without help that means walking the block list from the head
+    - This optional index keeps EVERY block (processes and holes) in a
+      treap sorted by start address: a lookup is one root-to-leaf path
+    - Blocks never overlap, so the block holding X is simply the one with
+      the highest start address <= X
+    - Kept up to date by splitBlock() / mergeWithNext() in memory_manager.c
+================================================================================
+*/
+
+#ifndef ADDRESS_INDEX_H
+#define ADDRESS_INDEX_H
+
+#include "memory_manager.h"
+
+
+/*
+================================================================================
+STRUCTURE: AddressIndex
+================================================================================
+PURPOSE: Root of a treap over all blocks (nodes live in the blocks)
+
+Same idea as the hole tree (hole_tree.h) but with its own links
+(addrLeft / addrRight / addrPriority), because a hole is in both trees.
+A block's start address never changes while it exists, so only new
+blocks (split) and vanished blocks (merge) touch the tree; allocating
+and freeing in place cost nothing.
+*/
+
+typedef struct AddressIndex {
+    MemoryBlock *root;
+    int numNodes;
+    unsigned int seed;          // Random number state for priorities
+} AddressIndex;
+
+
+/*
+================================================================================
+STRUCTURE: BlockRange
+================================================================================
+PURPOSE: Iterator over the blocks that overlap [from, to)
+
+The block list is already in address order, so after one lookup for
+'from' the iterator just follows next pointers: O(log n + blocks seen).
+
+EXAMPLE: print everything between 300 and 600
+BlockRange range;
+for (MemoryBlock *b = beginBlockRange(&mm, &range, 300, 600);
+     b != NULL; b = nextInBlockRange(&range)) {
+    printf("%d-%d\n", b->startAddress, b->endAddress);
+}
+*/
+
+typedef struct BlockRange {
+    MemoryBlock *current;
+    int to;                     // First address past the range
+} BlockRange;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableAddressIndex / disableAddressIndex
+--------------------------------------------------------------------------------
+PURPOSE: Build the index from the current blocks (caller owns 'index')
+
+RETURNS: 1 (the tree lives in the blocks, no extra memory is needed)
+*/
+int enableAddressIndex(MemoryManager *mm, AddressIndex *index);
+void disableAddressIndex(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: findBlockAt
+--------------------------------------------------------------------------------
+PURPOSE: The block (process or hole) that contains 'address'
+
+O(log n) with an AddressIndex attached, a list walk without one.
+
+RETURNS: The block, or NULL if 'address' is in the OS region or past
+         the end of memory
+*/
+MemoryBlock *findBlockAt(MemoryManager *mm, int address);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: beginBlockRange / nextInBlockRange
+--------------------------------------------------------------------------------
+PURPOSE: Visit the blocks overlapping [from, to) in address order
+
+RETURNS: The next block, or NULL when the range is done
+
+NOTE: Don't allocate or free while iterating - a merge frees blocks.
+*/
+MemoryBlock *beginBlockRange(MemoryManager *mm, BlockRange *range, int from, int to);
+MemoryBlock *nextInBlockRange(BlockRange *range);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: deallocateAt
+--------------------------------------------------------------------------------
+PURPOSE: Free the process whose block STARTS at 'address'
+
+Like free(ptr): the address must be one that allocateMemory() returned.
+An address inside a block or inside a hole is rejected. A segmented
+process is freed completely (all its segments), as deallocateMemory()
+does. Works with the bitmap and compact backends too.
+
+RETURNS: 1 on success, 0 if no process starts at 'address'
+*/
+int deallocateAt(MemoryManager *mm, int address);
+
+
+/*
+--------------------------------------------------------------------------------
+UPDATES (called by splitBlock() / mergeWithNext() only; no-ops without
+an index)
+--------------------------------------------------------------------------------
+*/
+void addressIndexInsert(MemoryManager *mm, MemoryBlock *block);
+void addressIndexRemove(MemoryManager *mm, MemoryBlock *block);
+
+
+#ifdef MM_DEBUG_CHECKS
+/*
+--------------------------------------------------------------------------------
+FUNCTION: addressIndexCheck (debug builds only: -DMM_DEBUG_CHECKS)
+--------------------------------------------------------------------------------
+PURPOSE: Verify order, priorities and that every block is in the tree
+
+RETURNS: 1 if the index is consistent, 0 (with an error printed) if not
+*/
+int addressIndexCheck(MemoryManager *mm);
+#endif
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: address_index.h
+================================================================================
+*/
@@ -0,0 +1,191 @@
+/*
+================================================================================
+FILE: admission_queue.h
+PURPOSE: Let failed allocation requests wait for space instead of failing
+DESCRIPTION:
+    - submitRequest() allocates right away if it can, otherwise the
+      request joins a pending queue
+    - Every deallocateMemory() retries waiting requests - but only the
+      ones that fit in the hole that was just freed
+    - Wait times are recorded so queueing delay can be reported
+================================================================================
+*/
+
+#ifndef ADMISSION_QUEUE_H
+#define ADMISSION_QUEUE_H
+
+#include "memory_manager.h"
+
+
+/*
+================================================================================
+ENUMERATION: AdmissionPolicy
+================================================================================
+PURPOSE: Which waiting request gets space first
+
+ADMIT_FIFO           - Oldest request first
+ADMIT_SMALLEST_FIRST - Smallest request first (more requests get in)
+ADMIT_PRIORITY       - Highest priority first (oldest first on ties)
+
+In every policy a request that does not fit is skipped, so one huge
+request cannot block smaller ones behind it.
+*/
+
+typedef enum {
+    ADMIT_FIFO,
+    ADMIT_SMALLEST_FIRST,
+    ADMIT_PRIORITY
+} AdmissionPolicy;
+
+
+/*
+================================================================================
+STRUCTURE: PendingRequest
+================================================================================
+*/
+
+typedef struct PendingRequest {
+    int processID;
+    int size;                   // KB
+    int priority;               // Higher = sooner (ADMIT_PRIORITY only)
+    AllocationAlgorithm algo;   // Algorithm to use when retried
+    long sequence;              // Arrival order (tie-break)
+    double enqueuedAt;          // Time the request started waiting
+} PendingRequest;
+
+
+/*
+================================================================================
+STRUCTURE: AdmissionQueue
+================================================================================
+PURPOSE: Waiting requests (kept sorted by policy) + wait-time samples
+
+WHY RETRIES ARE CHEAP:
+Every waiting request was bigger than the largest hole when it last
+failed. Freeing memory only changes ONE hole - the newly merged one - so
+a request can only fit now if size <= that hole's size. minSize lets us
+skip the whole queue in O(1) when even the smallest waiter is too big.
+
+TIME:
+By default time is counted in operations (each submit or free = 1 tick).
+A simulation can call setAdmissionTime() to use its own clock instead.
+*/
+
+typedef struct AdmissionQueue {
+    AdmissionPolicy policy;
+
+    PendingRequest *pending;    // Sorted in admission order
+    int numPending;
+    int capacity;
+    int minSize;                // Smallest pending size (KB)
+    long nextSequence;
+
+    double now;                 // Current time
+    int externalClock;          // 1 once setAdmissionTime() was called
+    int admitting;              // 1 while admitPendingRequests() walks pending[]
+    int admitAgain;             // A nested call asked for another walk
+
+    // Optional: called after a waiting request gets memory
+    // (the simulation uses it to schedule the process's departure)
+    void (*onAdmit)(void *context, int processID);
+    void *onAdmitContext;
+
+    // Statistics
+    double *waitTimes;          // One sample per admitted request
+    int numAdmitted;
+    int waitCapacity;
+    long retries;               // Waiters actually retried
+    long skippedScans;          // Frees that skipped the queue in O(1)
+} AdmissionQueue;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableAdmissionQueue / disableAdmissionQueue
+--------------------------------------------------------------------------------
+PURPOSE: Attach an empty queue to 'mm' (caller owns 'queue') / detach it
+
+disableAdmissionQueue() drops requests that are still waiting.
+
+EXAMPLE CALL:
+AdmissionQueue queue;
+enableAdmissionQueue(&mm, &queue, ADMIT_SMALLEST_FIRST);
+*/
+void enableAdmissionQueue(MemoryManager *mm, AdmissionQueue *queue,
+                          AdmissionPolicy policy);
+void disableAdmissionQueue(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: submitRequest
+--------------------------------------------------------------------------------
+PURPOSE: Allocate now, or wait in the queue if no hole is big enough
+
+RETURNS:
+- Start address if allocated immediately
+- -1 if the request is waiting (or rejected: invalid size, or bigger
+  than all of user memory so it could never fit)
+*/
+int submitRequest(MemoryManager *mm, int processID, int size, int priority,
+                  AllocationAlgorithm algo);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: admitPendingRequests
+--------------------------------------------------------------------------------
+PURPOSE: Retry waiters after a free (called by deallocateMemory())
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- holeSize: Size of the hole that was just freed/merged, or -1 if
+            several holes grew (the largest hole is then looked up)
+
+Each admission is an allocateMemory() call, and a defragmenter step in
+there calls this again. That nested call does not touch the queue: the
+outer walk goes round once more instead (holes may have merged).
+
+RETURNS: Number of waiting requests that got memory
+*/
+int admitPendingRequests(MemoryManager *mm, int holeSize);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: cancelPendingRequest
+--------------------------------------------------------------------------------
+RETURNS: 1 if 'processID' was waiting and is removed, 0 otherwise
+*/
+int cancelPendingRequest(MemoryManager *mm, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: setAdmissionTime
+--------------------------------------------------------------------------------
+PURPOSE: Use an external clock (e.g. simulated time) for wait times
+*/
+void setAdmissionTime(MemoryManager *mm, double now);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayAdmissionStats
+--------------------------------------------------------------------------------
+PURPOSE: Print the wait-time distribution
+
+EXAMPLE OUTPUT:
+Admission queue (smallest-first): 3 waiting, 120 admitted after waiting
+Wait time: mean 4.20 | p50 2.00 | p90 9.00 | p99 31.00 | max 40.00
+*/
+void displayAdmissionStats(MemoryManager *mm);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: admission_queue.h
+================================================================================
+*/
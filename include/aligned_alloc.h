@@ -0,0 +1,61 @@
+/*
+================================================================================
+FILE: aligned_alloc.h
+PURPOSE: Allocate a process at an address that is a multiple of 'align'
+DESCRIPTION:
+    - allocateMemory() always starts a process at the start of its hole
+    - Real systems often need aligned placements (4 KB pages, 2 MB or
+      1 GB huge pages), which may mean skipping a few KB at the start
+    - The skipped KB are NOT lost: they stay behind as their own hole
+================================================================================
+*/
+
+#ifndef ALIGNED_ALLOC_H
+#define ALIGNED_ALLOC_H
+
+#include "memory_manager.h"
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: allocateAligned
+--------------------------------------------------------------------------------
+PURPOSE: Like allocateMemory(), but the start address is a multiple of 'align'
+
+HOW A HOLE IS CHOSEN:
+For each hole: alignedStart = start rounded up to a multiple of 'align'
+               leading waste = alignedStart - start
+The hole fits if (leading waste + size) <= hole size.
+Among fitting holes, the one with the LEAST leading waste wins; 'algo'
+only breaks ties:
+- FIRST_FIT: lowest address
+- BEST_FIT:  smallest space left after the process
+- WORST_FIT: largest space left after the process
+
+WHAT HAPPENS TO THE WASTE:
+[HOLE: 260-1023] with align 512 →
+[HOLE: 260-511][P1: 512-...][HOLE: ...-1023]
+The leading fragment is an ordinary hole: it counts in numHoles,
+in calculateFragmentation(), and later allocations can use it.
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- processID: Process ID
+- size: Size in KB
+- align: Alignment in KB (4 = 4K page, 2048 = 2M, 1048576 = 1G)
+- algo: Tie-break rule (see above)
+
+RETURNS: Aligned starting address, or -1 if no hole fits (or the
+         bitmap backend is on - it has no blocks to split)
+*/
+int allocateAligned(MemoryManager *mm, int processID, int size,
+                    int align, AllocationAlgorithm algo);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: aligned_alloc.h
+================================================================================
+*/
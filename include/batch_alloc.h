@@ -0,0 +1,102 @@
+/*
+================================================================================
+FILE: batch_alloc.h
+PURPOSE: Allocate or free many processes with one call
+DESCRIPTION:
+    - allocateBatch() places n processes without restarting every search
+      from the head of memory
+    - allocateBatchRelaxed() may reorder requests (largest first)
+    - deallocateBatch() frees many processes and merges each run of
+      adjacent holes only once
+================================================================================
+*/
+
+#ifndef BATCH_ALLOC_H
+#define BATCH_ALLOC_H
+
+#include "memory_manager.h"
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: allocateBatch
+--------------------------------------------------------------------------------
+PURPOSE: Same result as calling allocateMemory() n times in order, faster
+
+HOW IT STAYS IDENTICAL TO THE ONE-BY-ONE PATH:
+- FIRST FIT: remembers where the last process was placed and the largest
+  hole before that point. If the next request is bigger than that hole,
+  nothing before the cursor can fit, so the search resumes at the cursor
+  instead of the head.
+- BEST / WORST FIT: builds one array of holes sorted by (size, address)
+  and uses binary search per request instead of walking every block.
+  Ties go to the lowest address, exactly like bestFit()/worstFit().
+- QUICK LISTS: a parked hole of exactly the requested size is taken
+  first, and a failed search sweeps the lists and tries again, just as
+  allocateMemory() does.
+- BITMAP BACKEND, SWAPPING, INCREMENTAL COMPACTION: these change memory
+  inside allocateMemory() (or have no blocks to walk), so the batch is
+  simply one allocateMemory() call per request.
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- pids, sizes: n requests (pids[i] needs sizes[i] KB)
+- n: Number of requests
+- algo: FIRST_FIT, BEST_FIT or WORST_FIT
+- outAddrs: Receives each start address, or -1 if that request failed
+
+RETURNS: Number of requests that were placed
+
+EXAMPLE:
+int pids[] = {1, 2, 3}, sizes[] = {100, 200, 150}, addrs[3];
+allocateBatch(&mm, pids, sizes, 3, FIRST_FIT, addrs);
+// addrs = {256, 356, 556} - same as three allocateMemory() calls
+*/
+int allocateBatch(MemoryManager *mm, const int pids[], const int sizes[],
+                  int n, AllocationAlgorithm algo, int outAddrs[]);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: allocateBatchRelaxed
+--------------------------------------------------------------------------------
+PURPOSE: Like allocateBatch(), but places the LARGEST requests first
+
+RELAXED MODE:
+Placements may differ from the one-by-one order (that is the point:
+big requests get first pick, so fewer of them fail). outAddrs[i] still
+belongs to pids[i].
+*/
+int allocateBatchRelaxed(MemoryManager *mm, const int pids[], const int sizes[],
+                         int n, AllocationAlgorithm algo, int outAddrs[]);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: deallocateBatch
+--------------------------------------------------------------------------------
+PURPOSE: Free several processes, merging holes once per run
+
+HOW IT WORKS:
+1. One pass over memory turns every listed process into a hole
+2. A second pass merges each run of neighbouring holes into one
+   (a run of k holes costs one merge pass, not k separate merges)
+
+NOTE: every block owned by a listed PID is freed. A listed PID that is
+swapped out is dropped from the backing store, and the defragmenter (if
+on) takes one step after the pass - so the result is the same as one
+deallocateMemory() per PID. With the bitmap or compact backend it is
+one deallocateMemory() call per PID instead.
+
+RETURNS: Number of processes freed (in memory or swapped out)
+*/
+int deallocateBatch(MemoryManager *mm, const int pids[], int n);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: batch_alloc.h
+================================================================================
+*/
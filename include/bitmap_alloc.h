@@ -0,0 +1,169 @@
+/*
+================================================================================
+FILE: bitmap_alloc.h
+PURPOSE: Bitmap backend - one bit per unit instead of a block per partition
+DESCRIPTION:
+    - User memory is cut into units (1 KB or more); bit = 1 means used
+    - A process is a run of used bits; a hole is a run of free bits
+    - Runs are found 64 units at a time with count-trailing-zeros, and a
+      summary bitmap (one bit per word: "this word is full") skips 4096
+      full units with a single compare
+    - Same First / Best / Worst Fit rules as the block list, so the two
+      can be compared on metadata size and speed
+    - Attached to a MemoryManager: allocateMemory() / deallocateMemory()
+      then use the bitmap instead of the block list
+================================================================================
+*/
+
+#ifndef BITMAP_ALLOC_H
+#define BITMAP_ALLOC_H
+
+#include "memory_manager.h"
+
+
+/*
+================================================================================
+STRUCTURE: BitmapEntry
+================================================================================
+PURPOSE: Where one process lives (the bitmap itself has no owners)
+*/
+
+typedef struct BitmapEntry {
+    int processID;          // -1 = empty slot
+    int firstUnit;
+    int numUnits;
+} BitmapEntry;
+
+
+/*
+================================================================================
+STRUCTURE: BitmapBackend
+================================================================================
+PURPOSE: The unit bitmap, its summary and the process table
+
+EXAMPLE: 1 KB units, 16 units shown, P1 = 4 KB at unit 0, P2 = 3 KB at 6
+units: [1111 0011 1000 0000]   → holes: units 4-5 and 9-15
+
+THE SUMMARY LEVEL:
+fullWords bit w = 1 when bits[w] is all ones. A summary word of all
+ones means 64 words (4096 units) are full - skipped in one step.
+
+PROCESS TABLE:
+Open addressing by PID (linear probing), so a free is O(1) to find.
+*/
+
+typedef struct BitmapBackend {
+    int unitSize;           // KB per bit
+    int baseAddress;        // Physical address of unit 0 (end of OS)
+    int numUnits;
+    int freeUnits;
+
+    unsigned long long *bits;       // 1 = used; bits past numUnits stay 1
+    int numWords;
+    unsigned long long *fullWords;  // Summary: 1 = that word is full
+    int numSummaryWords;
+
+    BitmapEntry *table;     // Process table (capacity is a power of 2)
+    int tableCapacity;
+    int tableCount;
+
+    long wordsScanned;      // Bitmap words looked at by searches
+} BitmapBackend;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableBitmapBackend / disableBitmapBackend
+--------------------------------------------------------------------------------
+PURPOSE: Switch an EMPTY memory manager to the bitmap (caller owns 'bb')
+
+Sizes are rounded up to whole units (unitSize 1 = exact, same placements
+as the block list). The block list is left alone; the other extensions
+(quick lists, swapping, segments, ...) work on the block list only.
+
+RETURNS: 1 on success, 0 if processes are loaded, segmentation is on
+         (segment tables hold block pointers), a compact pool is on, bad
+         unit size or out of memory
+*/
+int enableBitmapBackend(MemoryManager *mm, BitmapBackend *bb, int unitSize);
+void disableBitmapBackend(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: requireBlockList
+--------------------------------------------------------------------------------
+PURPOSE: Guard for operations that only know the block list
+
+allocateAligned(), resizeMemory() and allocateSegments() split and bind
+blocks directly, so they would place processes the bitmap never hears
+of. They call this first and fail while a bitmap - or a compact pool (see
+compact_blocks.h) - is attached. (allocateBatch() and deallocateBatch()
+instead fall back to one allocateMemory() / deallocateMemory() call per
+request.)
+
+RETURNS: 1 if neither is attached, else 0 after
+         "Error: <operation> needs the block list, not the bitmap backend!"
+         (or "... the compact backend!")
+*/
+int requireBlockList(MemoryManager *mm, const char *operation);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: bitmapAllocate / bitmapFree
+--------------------------------------------------------------------------------
+Called by allocateMemory() / deallocateMemory() when a bitmap is attached.
+
+bitmapAllocate - Returns the start address, or -1 if no run is long enough
+bitmapFree     - Returns 1, or 0 if the process is not in memory
+*/
+int bitmapAllocate(MemoryManager *mm, int processID, int size, AllocationAlgorithm algo);
+int bitmapFree(MemoryManager *mm, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+LOOKUPS
+--------------------------------------------------------------------------------
+bitmapLargestRun     - Largest hole in KB (used by largestHoleSize())
+bitmapMetadataBytes  - Bytes of bookkeeping: bitmap + summary + table
+bitmapProcessAt      - PID whose run starts at 'address', or -1
+                       (looks through the process table: O(table size))
+listBitmapProcesses  - Print "  P1 (100 KB at address 256)" lines in
+                       address order; returns how many
+displayBitmap        - One character per unit group, like displayPaging()
+*/
+int bitmapLargestRun(MemoryManager *mm);
+long bitmapMetadataBytes(BitmapBackend *bb);
+int bitmapProcessAt(MemoryManager *mm, int address);
+int listBitmapProcesses(MemoryManager *mm);
+void displayBitmap(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compareBackends
+--------------------------------------------------------------------------------
+PURPOSE: Run one random workload on the block list and on the bitmap
+
+Each fit algorithm runs 'numOps' random allocate / free steps (seeded,
+so both backends see the same requests) over 'userMemory' KB. Prints
+placements, time and metadata bytes for both, and whether every
+address matched.
+
+EXAMPLE OUTPUT:
+Algorithm  Backend  Placed  Time (ms)  Metadata   Same
+First Fit  List     9990    12.40      98304 B
+First Fit  Bitmap   9990    3.10       9344 B     yes
+*/
+void compareBackends(int userMemory, int numOps, unsigned int seed);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: bitmap_alloc.h
+================================================================================
+*/
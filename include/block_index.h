@@ -0,0 +1,139 @@
+/*
+================================================================================
+FILE: block_index.h
+PURPOSE: Optional indexes so common questions don't need a list walk
+DESCRIPTION:
+    - PID index:  "where is process P?"   → hash table, O(1)
+    - Hole index: "how big is the largest hole?" → max-heap, O(1)
+    - Victim order: "which process was used longest ago?" → LRU list,
+      O(1); "which is the largest / the smallest of at least N KB?" →
+      tree of processes by size, O(log n)
+    - Both are kept up to date by the block list steps in
+      memory_manager.c (splitBlock, mergeWithNext, bindBlock, unbindBlock)
+    - Used by swapping (victim search) and by findProcessBlock()
+================================================================================
+*/
+
+#ifndef BLOCK_INDEX_H
+#define BLOCK_INDEX_H
+
+#include "memory_structures.h"
+
+
+/*
+================================================================================
+STRUCTURE: BlockIndex
+================================================================================
+PURPOSE: The two indexes plus the "last used" clock
+
+HOLE HEAP:
+holeHeap[0] is always the largest hole. Each hole remembers its own
+position (block->holeHeapIndex), so a hole that grows, shrinks or
+disappears is fixed up in O(log n) without searching for it.
+
+PID BUCKETS:
+pidBuckets[hash(pid)] is a chain of process blocks linked through
+block->pidNext. The table doubles when it gets full.
+
+VICTIM ORDER (for swapping):
+Every process that may be swapped out is on two more structures:
+- The LRU list, oldest use first. A new or touched process goes to the
+  back, so the front is always the least recently used one
+- A treap (like the hole tree) sorted by (size, address), so the largest
+  process and the smallest one of at least N KB are found in O(log n)
+Segments are taken off both (indexProcessPinned) - they never swap.
+*/
+
+typedef struct BlockIndex {
+    MemoryBlock **holeHeap;
+    int heapSize;
+    int heapCapacity;
+
+    MemoryBlock **pidBuckets;
+    int numBuckets;             // Always a power of 2
+    int numIndexed;             // Process blocks in the table
+
+    long tick;                  // Grows on every bind/touch (for LRU)
+
+    MemoryBlock *lruOldest;     // Front of the LRU list (next LRU victim)
+    MemoryBlock *lruNewest;     // Back of the LRU list (used last)
+    MemoryBlock *sizeRoot;      // Treap of processes by (size, address)
+    unsigned int seed;          // Treap priorities
+} BlockIndex;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableBlockIndex / disableBlockIndex
+--------------------------------------------------------------------------------
+PURPOSE: Build both indexes from the current list (caller owns 'index')
+
+RETURNS: 1 on success, 0 if out of memory
+*/
+int enableBlockIndex(MemoryManager *mm, BlockIndex *index);
+void disableBlockIndex(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+LOOKUPS
+--------------------------------------------------------------------------------
+indexFindProcess - Block of 'processID', or NULL (index must be attached)
+largestHoleSize  - Size of the largest hole in KB (0 if none). Uses the
+                   heap (or a hole tree) when attached, otherwise walks
+                   the hole list
+touchProcess     - Mark a process as just used (for LRU swapping):
+                   it moves to the back of the LRU list. Returns 1, or
+                   0 if it is not in memory (or no index is attached)
+*/
+MemoryBlock *indexFindProcess(MemoryManager *mm, int processID);
+int largestHoleSize(MemoryManager *mm);
+int touchProcess(MemoryManager *mm, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+VICTIM LOOKUPS (index must be attached; segments are never returned)
+--------------------------------------------------------------------------------
+indexLeastRecentlyUsed - Front of the LRU list, O(1)
+indexLargestProcess    - Largest process (lowest address on a tie), O(log n)
+indexSmallestAtLeast   - Smallest process of at least 'size' KB, O(log n)
+All return NULL if there is no such process.
+*/
+MemoryBlock *indexLeastRecentlyUsed(MemoryManager *mm);
+MemoryBlock *indexLargestProcess(MemoryManager *mm);
+MemoryBlock *indexSmallestAtLeast(MemoryManager *mm, int size);
+
+
+/*
+--------------------------------------------------------------------------------
+UPDATES (called by the block list steps only; no-ops without an index)
+--------------------------------------------------------------------------------
+indexHoleChanged    - A hole was created or changed size
+indexHoleRemoved    - A hole is about to be merged away or bound
+indexProcessAdded   - A hole just became a process
+indexProcessRemoved - A process is about to become a hole
+
+Also called from outside the block list steps:
+indexProcessPinned  - pinned = 1: a segment, take it off the victim
+                      order; 0: an ordinary process again (segmentation.c)
+indexRestoreUse     - A process was just moved to 'block' (compaction):
+                      give it back its old place on the LRU list, right
+                      after 'usedBefore' (NULL = front), and 'lastUsed'
+*/
+void indexHoleChanged(MemoryManager *mm, MemoryBlock *hole);
+void indexHoleRemoved(MemoryManager *mm, MemoryBlock *hole);
+void indexProcessAdded(MemoryManager *mm, MemoryBlock *block);
+void indexProcessRemoved(MemoryManager *mm, MemoryBlock *block);
+void indexProcessPinned(MemoryManager *mm, MemoryBlock *block, int pinned);
+void indexRestoreUse(MemoryManager *mm, MemoryBlock *block,
+                     MemoryBlock *usedBefore, long lastUsed);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: block_index.h
+================================================================================
+*/
@@ -0,0 +1,224 @@
+/*
+================================================================================
+FILE: compact_blocks.h
+PURPOSE: A 16-byte block layout for very large simulated heaps
+DESCRIPTION:
+    - MemoryBlock carries a link for every optional index (hole list,
+      heap, PID table, two trees, quick lists...): 200 bytes, plus the
+      malloc header of each separate allocation
+    - With tens of millions of partitions that metadata, not the
+      simulation, is what runs out of memory
+    - A CompactBlock keeps only what cannot be worked out:
+      start, size (with the hole flag in its top bit), next, owner.
+      The end address is start + size - 1
+    - Blocks live side by side in one pool array and link to each other
+      by 32-bit index instead of by 64-bit pointer; freed entries are
+      reused, so there is one allocation for the whole heap
+    - Same First / Best / Worst Fit rules (and placements) as the block
+      list; the price is that searches and frees walk the list, like the
+      block list with no index attached
+    - Attached to a MemoryManager (like the bitmap backend):
+      allocateMemory() / deallocateMemory() then use the pool instead of
+      the block list - --compact on the command line
+================================================================================
+*/
+
+#ifndef COMPACT_BLOCKS_H
+#define COMPACT_BLOCKS_H
+
+#include "memory_manager.h"
+
+#define COMPACT_NONE 0xFFFFFFFFu        // "No block" index (like NULL)
+#define COMPACT_HOLE_BIT 0x80000000u    // Top bit of sizeAndFlag
+
+
+/*
+================================================================================
+STRUCTURE: CompactBlock
+================================================================================
+PURPOSE: One partition in 16 bytes
+
+sizeAndFlag:  [H|            size in KB (31 bits)             ]
+               ^ 1 = hole, 0 = process
+
+EXAMPLE: P1 = 100 KB at 256, then a 668 KB hole (pool entries 0 and 1)
+entry 0: start 256, sizeAndFlag 100,                next 1,            pid 1
+entry 1: start 356, sizeAndFlag 668 | HOLE_BIT,     next COMPACT_NONE, pid -1
+*/
+
+typedef struct CompactBlock {
+    unsigned int startAddress;
+    unsigned int sizeAndFlag;
+    unsigned int next;      // Pool index of the next block in memory
+    int processID;          // -1 for a hole
+} CompactBlock;
+
+
+/*
+================================================================================
+STRUCTURE: CompactPool
+================================================================================
+PURPOSE: The pool of blocks and the totals the MemoryManager keeps
+
+Unused entries are chained through 'next' from freeEntry. firstHole
+is where every search starts: blocks before it are all processes.
+*/
+
+typedef struct CompactPool {
+    CompactBlock *blocks;
+    unsigned int capacity;  // Entries allocated
+    unsigned int used;      // Entries ever handed out (high-water mark)
+    unsigned int freeEntry; // First reusable entry, or COMPACT_NONE
+    unsigned int head;      // Lowest-address block
+    unsigned int firstHole; // Lowest-address hole, or COMPACT_NONE
+
+    int totalMemory;
+    int osMemory;
+    int userMemory;
+    int freeMemory;
+    int numProcesses;
+    int numHoles;
+} CompactPool;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initCompactPool / freeCompactPool
+--------------------------------------------------------------------------------
+PURPOSE: One hole covering user memory / release the pool
+
+expectedBlocks sizes the pool up front (it doubles when full); a good
+guess avoids both copying and unused entries.
+
+RETURNS: 1 on success, 0 if out of memory
+*/
+int initCompactPool(CompactPool *pool, int totalMem, int osMem, unsigned int expectedBlocks);
+void freeCompactPool(CompactPool *pool);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compactAllocate / compactDeallocate
+--------------------------------------------------------------------------------
+compactAllocate   - Start address, or -1 if no hole fits. O(blocks from
+                    firstHole) - First Fit stops at the first hole that fits
+compactDeallocate - 1 if the process was found and freed (and merged
+                    with hole neighbours), 0 if not. O(blocks before it)
+*/
+int compactAllocate(CompactPool *pool, int processID, int size, AllocationAlgorithm algo);
+int compactDeallocate(CompactPool *pool, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compactBlockSize / compactBlockIsHole
+--------------------------------------------------------------------------------
+PURPOSE: Read sizeAndFlag (for code walking the pool from outside)
+*/
+int compactBlockSize(const CompactBlock *block);
+int compactBlockIsHole(const CompactBlock *block);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableCompactBackend / disableCompactBackend
+--------------------------------------------------------------------------------
+PURPOSE: Switch an EMPTY memory manager to a compact pool (caller owns
+         'pool'; expectedBlocks as for initCompactPool())
+
+Placements are the same as the block list's. The block list is left
+alone; the other extensions (quick lists, swapping, segments, the
+defragmenter, ...) work on the block list only, and the indexes stay
+idle - frees and searches walk the pool.
+
+RETURNS: 1 on success, 0 if processes are loaded, segmentation is on,
+         the bitmap backend is on, or out of memory
+*/
+int enableCompactBackend(MemoryManager *mm, CompactPool *pool, unsigned int expectedBlocks);
+void disableCompactBackend(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compactBackendAllocate / compactBackendFree / compactProcessAt
+--------------------------------------------------------------------------------
+Called by allocateMemory() / deallocateMemory() / deallocateAt() when a
+pool is attached; they keep the manager's totals (and usage map) in step.
+
+compactBackendAllocate - Start address, or -1 if no hole fits
+compactBackendFree     - 1, or 0 if the process is not in memory
+compactProcessAt       - PID whose block starts at 'address', or -1
+*/
+int compactBackendAllocate(MemoryManager *mm, int processID, int size, AllocationAlgorithm algo);
+int compactBackendFree(MemoryManager *mm, int processID);
+int compactProcessAt(CompactPool *pool, int address);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compactLargestHole / compactFragmentation
+--------------------------------------------------------------------------------
+Same meaning as largestHoleSize() / calculateFragmentation()
+*/
+int compactLargestHole(CompactPool *pool);
+float compactFragmentation(CompactPool *pool);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compactMetadataBytes / listMetadataBytes
+--------------------------------------------------------------------------------
+compactMetadataBytes - The whole pool, unused entries included
+listMetadataBytes    - What 'blocks' MemoryBlocks cost: the struct plus
+                       the malloc header, rounded to 16 bytes the way
+                       common allocators (glibc, musl) do
+*/
+long compactMetadataBytes(CompactPool *pool);
+long listMetadataBytes(long blocks);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayCompactPool
+--------------------------------------------------------------------------------
+PURPOSE: The first blocks, the totals and the metadata per block
+
+EXAMPLE OUTPUT:
+[256-355 P1] [356-1023 hole]
+Processes: 1 | Holes: 1 | Free: 668 KB | Fragmentation: 0.00%
+Metadata: 256 bytes for 2 blocks = 128.0 bytes/block (16 per entry, 16 entries)
+Block list: 416 bytes = 208.0 bytes/block
+
+(The pool starts at 16 entries and doubles, so up to half of it can be
+spare: 16-32 bytes/block. Pass expectedBlocks to get 16.)
+*/
+void displayCompactPool(CompactPool *pool);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compareLayouts
+--------------------------------------------------------------------------------
+PURPOSE: Run one random workload on the block list and on a compact pool
+
+Checks both place every process at the same address and prints the
+time and metadata bytes per block of each.
+
+EXAMPLE OUTPUT:
+Algorithm  Layout   Placed  Time (ms)  Bytes/block  Same
+First Fit  List     2344    7.25       208.0
+First Fit  Compact  2344    20.47      17.1         yes
+
+Compact is slower here: its searches step over processes too, where
+the block list has a separate list of just the holes.
+*/
+void compareLayouts(int userMemory, int numOps, unsigned int seed);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: compact_blocks.h
+================================================================================
+*/
@@ -0,0 +1,184 @@
+/*
+================================================================================
+FILE: defrag.h
+PURPOSE: Incremental compaction - a little defragmenting on every operation
+DESCRIPTION:
+    - Compaction slides processes down so the holes between them join up
+      at the top of memory. Done all at once over a large heap it copies
+      everything and stalls every request while it runs
+    - The defragmenter does the same work in small steps: each step moves
+      at most 'budgetKB' KB of processes, then stops and remembers where
+      it got to. The next step carries on from there
+    - Steps run at the start of every allocateMemory() and the end of
+      every deallocateMemory() call, or on a timer tick of simulated time
+      (the simulator calls defragAdvanceClock())
+    - It counts KB moved and the fragmentation each step removed, so the
+      budget can be tuned: more KB per step = less fragmentation, but a
+      longer pause per operation
+================================================================================
+*/
+
+#ifndef DEFRAG_H
+#define DEFRAG_H
+
+#include "memory_manager.h"
+
+#define DEFRAG_MAX_VISITS 64    // Blocks one step may look at (moved or not)
+
+
+/*
+================================================================================
+HOW ONE MOVE WORKS
+================================================================================
+The process right after a hole slides down into it; the hole ends up
+after the process and merges with the next block if that is a hole too:
+
+Before: [P1][HOLE: 50][P2: 100][HOLE: 30][P3]
+Move P2 (100 KB copied):
+After:  [P1][P2: 100][HOLE: 80][P3]           ← one hole fewer
+
+It is made of the usual steps (RELEASE, MERGE, SPLIT, BIND), so the
+event log, hole list and every index stay right without knowing about
+compaction.
+
+NOT MOVED:
+- Segmented processes - their segment tables point at their blocks
+- Processes bigger than the whole budget - the step goes past them
+  to the next hole (a process that only needs a fresh budget waits for
+  the next step instead)
+
+WARNING: a moved process has a new start address. Keep process IDs,
+not addresses (deallocateMemory(), not deallocateAt()), while it is on.
+The address allocateMemory() returns is safe: steps run before the
+search, never after it.
+*/
+
+
+/*
+================================================================================
+STRUCTURE: Defragmenter
+================================================================================
+PURPOSE: Budget, where the sweep got to, and what it has done so far
+
+'cursor' is the start of the hole the next step works on. When the
+sweep reaches the top of memory it starts again from the lowest hole,
+so holes freed below the cursor are picked up on the next pass.
+*/
+
+typedef struct Defragmenter {
+    int budgetKB;               // Most KB one step may move
+    double tickInterval;        // 0 = step on each allocate/free,
+                                // > 0 = step every tickInterval of time
+    double nextTick;            // Simulated time of the next tick
+    int cursor;                 // Address the next step resumes at
+    int running;                // 1 while a step runs (no nested steps)
+
+    // Statistics
+    long steps;                 // Steps that moved something
+    long moves;                 // Processes moved
+    long kbMoved;               // Total KB copied
+    int maxStepKB;              // Most KB moved by one step
+    long holesMerged;           // Holes that disappeared
+    double fragmentationRemoved;// Sum of the drop in fragmentation (points)
+} Defragmenter;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableDefragmenter / disableDefragmenter
+--------------------------------------------------------------------------------
+PURPOSE: Start incremental compaction (caller owns 'defrag') / stop it
+
+PARAMETERS:
+- budgetKB: Most KB one step may move (must be > 0)
+- tickInterval: 0 = a step on every allocateMemory() / deallocateMemory();
+                > 0 = a step every tickInterval units of simulated time
+
+RETURNS: 1 on success, 0 if the budget is not positive or the bitmap
+         or compact backend is in use (it has no blocks to move)
+
+EXAMPLE:
+Defragmenter defrag;
+enableDefragmenter(&mm, &defrag, 64, 0);   // 64 KB per operation
+*/
+int enableDefragmenter(MemoryManager *mm, Defragmenter *defrag,
+                       int budgetKB, double tickInterval);
+void disableDefragmenter(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: defragStep
+--------------------------------------------------------------------------------
+PURPOSE: Move up to budgetKB KB of processes down, merging holes
+
+Looks at DEFRAG_MAX_VISITS blocks at most, so one step costs
+O(budget + DEFRAG_MAX_VISITS) plus finding the cursor again: O(log n)
+with a hole tree attached, otherwise a walk along the hole list.
+The statistics call calculateFragmentation() twice per step - O(1)
+with a BlockIndex or hole tree attached.
+
+RETURNS: KB moved (0 = nothing to do, or no defragmenter attached)
+*/
+int defragStep(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: defragOnOperation / defragAdvanceClock
+--------------------------------------------------------------------------------
+defragOnOperation  - Called by allocateMemory() / deallocateMemory();
+                     one step in per-operation mode, else nothing
+defragAdvanceClock - Called by the simulator when its clock moves to
+                     'now'; one step per tick that has passed in tick
+                     mode, else nothing. Once a step finds nothing to
+                     move, the remaining missed ticks are skipped
+*/
+void defragOnOperation(MemoryManager *mm);
+void defragAdvanceClock(MemoryManager *mm, double now);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayDefragStats
+--------------------------------------------------------------------------------
+EXAMPLE OUTPUT:
+Defragmenter: 64 KB per operation
+Moved 412 processes (13184 KB) in 230 steps, at most 64 KB per step
+Holes merged: 198 | Fragmentation removed: 61.20 points (4.753 per MB moved)
+
+"Points" are percentage points of calculateFragmentation(). The rate is
+given per MB because one KB moves too little to show in 3 decimals.
+*/
+void displayDefragStats(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compareDefragBudgets
+--------------------------------------------------------------------------------
+PURPOSE: Run one random workload with several budgets per operation
+
+Shows what each budget buys: average fragmentation, KB copied in total,
+the longest single step, and fragmentation removed per MB moved.
+
+EXAMPLE OUTPUT:
+Budget KB  Placed  Avg frag %  KB moved  Max KB/step  Pts per MB moved
+off        2035    7.51        0         0            -
+64         2056    4.74        208143    64           0.039
+256        2029    1.21        1072384   256          0.073
+...
+
+Small budgets barely help: most processes are bigger than the budget,
+so the holes behind them are never closed.
+*/
+void compareDefragBudgets(int userMemory, int numOps, unsigned int seed);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: defrag.h
+================================================================================
+*/
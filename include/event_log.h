@@ -0,0 +1,213 @@
+/*
+================================================================================
+FILE: event_log.h
+PURPOSE: Record memory changes as small "delta" events
+DESCRIPTION:
+    - Every operation is described by a few tiny events
+      (split a hole, merge two holes, bind a process, release a process)
+    - Every K events we also save a "keyframe" (a full copy of the blocks)
+    - Any earlier point in time can be rebuilt by starting at the nearest
+      keyframe and re-applying the events that came after it
+================================================================================
+*/
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include "memory_structures.h"
+
+
+/*
+================================================================================
+ENUMERATION: MemoryEventType
+================================================================================
+PURPOSE: The four kinds of change our allocator can make
+
+EVENT_SPLIT   - hole at addrA is cut in two, second part starts at value
+EVENT_MERGE   - hole at addrA swallows the hole that starts at value
+EVENT_BIND    - block at addrA (size KB) now belongs to processID
+EVENT_RELEASE - block at addrA (size KB) of processID becomes a hole
+*/
+
+typedef enum {
+    EVENT_SPLIT,
+    EVENT_MERGE,
+    EVENT_BIND,
+    EVENT_RELEASE
+} MemoryEventType;
+
+
+/*
+================================================================================
+STRUCTURE: MemoryEvent
+================================================================================
+PURPOSE: One delta (16 bytes, no matter how big memory is)
+
+FIELD MEANING PER TYPE:
+              addrA          value             processID
+SPLIT         hole start     split address     -1
+MERGE         left start     right start       -1
+BIND          block start    size (KB)         owner
+RELEASE       block start    size (KB)         old owner
+*/
+
+typedef struct MemoryEvent {
+    int type;
+    int addrA;
+    int value;
+    int processID;
+} MemoryEvent;
+
+
+/*
+================================================================================
+STRUCTURE: KeyframeBlock / Keyframe
+================================================================================
+PURPOSE: A saved copy of the block list at one point in time
+
+All keyframes share one big array of KeyframeBlock. Each Keyframe just
+remembers where its blocks start in that array and how many there are.
+*/
+
+typedef struct KeyframeBlock {
+    int startAddress;
+    int size;
+    int processID;      // -1 for a hole
+} KeyframeBlock;
+
+typedef struct Keyframe {
+    int eventIndex;     // Number of events that happened before this frame
+    int firstBlock;     // Index into EventLog.frameBlocks
+    int numBlocks;
+} Keyframe;
+
+
+/*
+================================================================================
+STRUCTURE: EventLog
+================================================================================
+PURPOSE: Growable arrays of events and keyframes
+
+MEMORY USE:
+Events grow by 16 bytes per change. Keyframes add one block list every
+keyframeInterval events, so memory is linear in the number of events
+instead of (events × blocks) like saving a full snapshot each time.
+*/
+
+typedef struct EventLog {
+    MemoryEvent *events;
+    int numEvents;
+    int eventCapacity;
+
+    Keyframe *keyframes;
+    int numKeyframes;
+    int keyframeCapacity;
+
+    KeyframeBlock *frameBlocks;
+    int numFrameBlocks;
+    int frameBlockCapacity;
+
+    // Save a keyframe every this many events (K)
+    int keyframeInterval;
+
+    // Layout of the memory being recorded (needed to rebuild it)
+    int totalMemory;
+    int osMemory;
+} EventLog;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initEventLog
+--------------------------------------------------------------------------------
+PURPOSE: Prepare an empty log
+PARAMETERS:
+- log: The log to set up
+- keyframeInterval: K, events between keyframes (values < 1 become 1)
+*/
+void initEventLog(EventLog *log, int keyframeInterval);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: attachEventLog
+--------------------------------------------------------------------------------
+PURPOSE: Start recording every change made to 'mm' into 'log'
+
+Saves keyframe 0 (the current state) so replay always has a starting point.
+Pass log = NULL to stop recording.
+
+EXAMPLE CALL:
+EventLog log;
+initEventLog(&log, 32);
+attachEventLog(&mm, &log);
+allocateMemory(&mm, 1, 100, FIRST_FIT);   // logs SPLIT + BIND
+*/
+void attachEventLog(MemoryManager *mm, EventLog *log);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: logEvent
+--------------------------------------------------------------------------------
+PURPOSE: Append one event (called by memory_manager.c)
+
+Does nothing if no log is attached, so the normal program pays nothing.
+Must be called BEFORE the block list is changed: when a keyframe is due,
+it copies the list as it looks right before this event.
+*/
+void logEvent(MemoryManager *mm, int type, int addrA, int value, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: rebuildFromEventLog
+--------------------------------------------------------------------------------
+PURPOSE: Recreate memory exactly as it was after 'eventIndex' events
+
+HOW IT WORKS:
+1. Find the last keyframe at or before eventIndex
+2. Copy its blocks into a fresh MemoryManager
+3. Apply the events between the keyframe and eventIndex
+
+PARAMETERS:
+- log: The recorded log
+- eventIndex: 0 .. log->numEvents
+- out: Receives the rebuilt memory (free it with freeMemoryManager)
+
+RETURNS:
+- 1 on success
+- 0 if eventIndex is out of range
+*/
+int rebuildFromEventLog(EventLog *log, int eventIndex, MemoryManager *out);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: truncateEventLog
+--------------------------------------------------------------------------------
+PURPOSE: Forget everything recorded after 'eventIndex' events
+
+Used when the user rewinds the timeline and then keeps working: the
+"future" events no longer happened, so they (and their keyframes) go.
+Keyframe 0 is always kept.
+*/
+void truncateEventLog(EventLog *log, int eventIndex);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: freeEventLog
+--------------------------------------------------------------------------------
+PURPOSE: Release all arrays owned by the log
+*/
+void freeEventLog(EventLog *log);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: event_log.h
+================================================================================
+*/
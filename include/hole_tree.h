@@ -0,0 +1,112 @@
+/*
+================================================================================
+FILE: hole_tree.h
+PURPOSE: Optional tree of holes that answers First Fit in O(log n)
+DESCRIPTION:
+    - First Fit wants "the LOWEST-ADDRESS hole that is big enough"
+    - A size index can't answer that, and the hole list still has to be
+      walked from the start - O(number of holes)
+    - This tree keeps the holes sorted by address, and every node also
+      remembers the largest hole anywhere below it
+    - Then First Fit walks ONE path from the root: left if the left
+      side has a hole that fits, else this hole, else right
+    - Kept up to date by the block list steps in memory_manager.c
+================================================================================
+*/
+
+#ifndef HOLE_TREE_H
+#define HOLE_TREE_H
+
+#include "memory_structures.h"
+
+
+/*
+================================================================================
+STRUCTURE: HoleTree
+================================================================================
+PURPOSE: Root of a treap over the holes (nodes live in the holes themselves)
+
+WHAT IS A TREAP?
+A binary search tree by startAddress that is ALSO a heap by a random
+priority (a parent's priority is never lower than its children's).
+The random priorities keep it balanced on average - depth about
+2 * log2(holes) - without any rebalancing rules to get wrong.
+
+EXAMPLE: holes (start/size) 256/50, 400/200, 700/100, 900/30
+                 [400/200, max 200]
+                 /                 \
+       [256/50, max 50]     [700/100, max 100]
+                                      \
+                               [900/30, max 30]
+First Fit for 80 KB: left max 50 < 80 → this node (200 ≥ 80) → 400
+*/
+
+typedef struct HoleTree {
+    MemoryBlock *root;
+    int numNodes;
+    unsigned int seed;          // Random number state for priorities
+} HoleTree;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableHoleTree / disableHoleTree
+--------------------------------------------------------------------------------
+PURPOSE: Build the tree from the current holes (caller owns 'tree')
+
+While it is attached, firstFit() and worstFit() search the tree instead
+of walking the hole list. Placements are exactly the same either way.
+
+RETURNS: 1 (building the tree needs no extra memory)
+*/
+int enableHoleTree(MemoryManager *mm, HoleTree *tree);
+void disableHoleTree(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+LOOKUPS (tree must be attached)
+--------------------------------------------------------------------------------
+holeTreeFirstFit   - Lowest-address hole of at least 'size' KB, or NULL
+holeTreeLargest    - Size of the largest hole (0 if none)
+holeTreeHoleBefore - Highest-address hole that starts below 'address',
+                     or NULL
+*/
+MemoryBlock *holeTreeFirstFit(MemoryManager *mm, int size);
+int holeTreeLargest(MemoryManager *mm);
+MemoryBlock *holeTreeHoleBefore(MemoryManager *mm, int address);
+
+
+/*
+--------------------------------------------------------------------------------
+UPDATES (called by the block list steps only; no-ops without a tree)
+--------------------------------------------------------------------------------
+holeTreeInsert  - A new hole appeared
+holeTreeRemove  - A hole is about to be merged away or bound
+holeTreeResized - A hole changed size (its start never moves)
+*/
+void holeTreeInsert(MemoryManager *mm, MemoryBlock *hole);
+void holeTreeRemove(MemoryManager *mm, MemoryBlock *hole);
+void holeTreeResized(MemoryManager *mm, MemoryBlock *hole);
+
+
+#ifdef MM_DEBUG_CHECKS
+/*
+--------------------------------------------------------------------------------
+FUNCTION: holeTreeCheck (debug builds only: -DMM_DEBUG_CHECKS)
+--------------------------------------------------------------------------------
+PURPOSE: Verify order, priorities, subtree maxima and the node count
+
+RETURNS: 1 if the tree is consistent, 0 (with an error printed) if not
+*/
+int holeTreeCheck(MemoryManager *mm);
+#endif
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: hole_tree.h
+================================================================================
+*/
@@ -94,6 +94,20 @@ After:  [OS: 0-255][HOLE: 256-1023]
 void initializeMemory(MemoryManager *mm, int totalMem, int osMem);
 
 
+/*
+--------------------------------------------------------------------------------
+FUNCTION: resetMemoryManager
+--------------------------------------------------------------------------------
+PURPOSE: Set every field to zero / NULL: no blocks, no counters, nothing
+         attached
+
+initializeMemory() and rebuildFromEventLog() start from this, so a new
+optional field is switched off everywhere without touching either.
+Frees nothing - call freeMemoryManager() first on a manager in use.
+*/
+void resetMemoryManager(MemoryManager *mm);
+
+
 /*
 --------------------------------------------------------------------------------
 FUNCTION: allocateMemory
@@ -397,6 +411,102 @@ Notice: Remaining hole (120KB) is still quite large and usable
 int worstFit(MemoryManager *mm, int processID, int size);
 
 
+/*
+================================================================================
+SHARED HELPERS
+================================================================================
+Small building blocks used by the algorithms above AND by the extra
+allocation modules (batch allocation, etc.), so every module changes
+the block list the same way.
+*/
+
+/*
+--------------------------------------------------------------------------------
+BLOCK LIST STEPS
+--------------------------------------------------------------------------------
+splitBlock    - Cut 'hole' at 'atAddress'; returns the new second hole
+mergeWithNext - 'hole' swallows the hole right after it
+bindBlock     - 'hole' now belongs to 'processID'
+unbindBlock   - A process block becomes a hole (no merging)
+
+Each one records its event, updates the statistics, the quick lists and
+the indexes. Other code should not change next/prev/size/isHole itself.
+*/
+MemoryBlock *splitBlock(MemoryManager *mm, MemoryBlock *hole, int atAddress);
+void mergeWithNext(MemoryManager *mm, MemoryBlock *hole);
+void bindBlock(MemoryManager *mm, MemoryBlock *hole, int processID);
+void unbindBlock(MemoryManager *mm, MemoryBlock *block);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: placeProcess
+--------------------------------------------------------------------------------
+PURPOSE: Put a process into a hole that has already been chosen
+
+WHAT IT DOES:
+1. If the hole is bigger than needed, split it (process + remaining hole)
+2. Mark the block as the process
+3. Update statistics and record events
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- hole: A hole with hole->size >= size
+- processID: Process receiving the memory
+- size: Size needed in KB
+
+RETURNS: Starting address of the process (always the hole's start)
+*/
+int placeProcess(MemoryManager *mm, MemoryBlock *hole, int processID, int size);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: releaseBlock
+--------------------------------------------------------------------------------
+PURPOSE: Free one process block that has already been found
+
+WHAT IT DOES:
+1. Turn the block into a hole and update statistics
+2. Merge it with the next and previous blocks if they are holes
+   (or park it on a quick list in deferred coalescing mode)
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- block: A process block
+
+RETURNS: The hole that now holds the freed space, or NULL if the block
+         was parked on a quick list (deferred coalescing)
+
+NOTE: 'block' may be freed by the merge - do not use it afterwards.
+*/
+MemoryBlock *releaseBlock(MemoryManager *mm, MemoryBlock *block);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: setVerbose / isVerbose
+--------------------------------------------------------------------------------
+PURPOSE: Turn the "Memory Initialized" banner and the "Error: ..." lines
+         of allocation and resizing on (1, the default) or off (0)
+
+Script mode turns them off: failures still show in the return values.
+*/
+void setVerbose(int on);
+int isVerbose(void);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: findProcessBlock
+--------------------------------------------------------------------------------
+PURPOSE: Find the block of a process (O(1) with a BlockIndex attached)
+
+RETURNS: The block, or NULL if the process is not in memory
+*/
+MemoryBlock *findProcessBlock(MemoryManager *mm, int processID);
+
+
 /*
 ================================================================================
 ALGORITHM COMPARISON SUMMARY
@@ -449,6 +559,12 @@ WHAT WE DECLARED:
 8. firstFit() - First Fit algorithm
 9. bestFit() - Best Fit algorithm
 10. worstFit() - Worst Fit algorithm
+11. placeProcess() - Shared split/commit helper
+12. releaseBlock() - Shared free/merge helper
+13. splitBlock() / mergeWithNext() / bindBlock() / unbindBlock()
+14. findProcessBlock() - Find a process by ID
+15. setVerbose() / isVerbose() - Banner and error messages on / off
+16. resetMemoryManager() - Every field zero / NULL
 
 NEXT FILE: src/memory_manager.c
 This will be the BIGGEST and most important file!
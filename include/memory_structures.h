@@ -72,6 +72,80 @@ typedef struct MemoryBlock {
     // Example: Block 1 → Block 2 → Block 3 → NULL (end)
     struct MemoryBlock *next;
     
+    // NOTE: Fields 7-28 are mostly links into the hole list and the
+    //       optional indexes - 200 bytes a block in all. For millions of blocks use the compact backend instead
+    //       (16 bytes a block, see compact_blocks.h)
+    
+    // FIELDS 7-9: quick list links (deferred coalescing mode only)
+    // Purpose: A freed hole can also sit on a "quick list" of holes with
+    //          exactly the same size, so it can be reused without a search
+    // Value: inQuickList = 1 while listed; quickPrev/quickNext link the
+    //        holes of one size together (NULL when not listed)
+    int inQuickList;
+    struct MemoryBlock *quickPrev;
+    struct MemoryBlock *quickNext;
+    
+    // FIELD 10: prev
+    // Purpose: Pointer to the previous block in memory
+    // Why? A block found through an index (not by walking the list) can
+    //      still be merged with the hole before it
+    // Example: NULL ← Block 1 ⇄ Block 2 ⇄ Block 3 → NULL
+    struct MemoryBlock *prev;
+    
+    // FIELDS 11-13: index links (only used when a BlockIndex is attached)
+    // Purpose: holeHeapIndex = position in the largest-hole heap (-1 if
+    //          not in it); pidNext = next block in the same PID bucket;
+    //          lastUsed = when the process was last used (for LRU swapping)
+    int holeHeapIndex;
+    struct MemoryBlock *pidNext;
+    long lastUsed;
+    
+    // FIELD 14: segment
+    // Purpose: Which segment of its process this block is
+    // Value: -1 = the whole process (normal), 0, 1, 2... = segment number
+    // Example: P3 with code/data/stack → three blocks, segment 0, 1, 2
+    int segment;
+    
+    // FIELDS 15-16: hole list links (holes only)
+    // Purpose: Every hole is also on a second list that skips processes,
+    //          in address order, so a search never looks at a process
+    // Value: prevHole/nextHole = the hole before/after this one in
+    //        memory, NULL for the first/last hole or for a process
+    // Example: [H1][P1][P2][H2][P3][H3] → hole list: H1 ⇄ H2 ⇄ H3
+    struct MemoryBlock *prevHole;
+    struct MemoryBlock *nextHole;
+    
+    // FIELDS 17-20: hole tree links (only used when a HoleTree is attached)
+    // Purpose: treeLeft/treeRight = children in the tree of holes (sorted
+    //          by address); treePriority = random number that keeps the
+    //          tree balanced; subtreeMax = largest hole in this subtree
+    struct MemoryBlock *treeLeft;
+    struct MemoryBlock *treeRight;
+    unsigned int treePriority;
+    int subtreeMax;
+    
+    // FIELDS 21-23: address index links (only used when an AddressIndex
+    //               is attached)
+    // Purpose: Every block - process or hole - in a second tree sorted by
+    //          address, so "which block holds address X?" skips the walk
+    //          (see address_index.h)
+    struct MemoryBlock *addrLeft;
+    struct MemoryBlock *addrRight;
+    unsigned int addrPriority;
+    
+    // FIELDS 24-28: swap victim links (processes only, only used when a
+    //               BlockIndex is attached)
+    // Purpose: lruOlder/lruNewer = neighbours on the list of processes
+    //          from least to most recently used; sizeLeft/sizeRight =
+    //          children in the tree of processes sorted by size;
+    //          sizePriority keeps that tree balanced
+    // Example: LRU list: P3 ⇄ P1 ⇄ P2 (P2 used last) → swap P3 first
+    struct MemoryBlock *lruOlder;
+    struct MemoryBlock *lruNewer;
+    struct MemoryBlock *sizeLeft;
+    struct MemoryBlock *sizeRight;
+    unsigned int sizePriority;
+    
 } MemoryBlock;
 // NOTE: The semicolon after } is important!
 
@@ -133,6 +207,23 @@ The MemoryManager is like a property manager who:
 - Maintains a list of all blocks
 */
 
+/*
+================================================================================
+STRUCTURE: ResizeStats
+================================================================================
+PURPOSE: Count how resizeMemory() satisfied requests (see resize.h)
+
+A resize that stays in place costs nothing. A resize that moves the
+process costs a copy of its old contents - that is what we want to avoid.
+*/
+
+typedef struct ResizeStats {
+    long resizesInPlace;    // Shrinks and grows that kept the address
+    long resizesMoved;      // Grows that had to move the process
+    long kbCopied;          // Total KB copied by moves
+} ResizeStats;
+
+
 typedef struct MemoryManager {
     // FIELD 1: head
     // Purpose: Pointer to the first block in our linked list
@@ -178,6 +269,89 @@ typedef struct MemoryManager {
     // Example: numHoles = 2 means 2 separate free spaces
     int numHoles;
     
+    // FIELD 8: eventLog
+    // Purpose: Optional recorder for split/merge/bind/release events
+    // Value: Pointer to an EventLog (see event_log.h), or NULL if disabled
+    // Example: The UI timeline replays these events instead of
+    //          keeping a full copy of memory after every action
+    struct EventLog *eventLog;
+    
+    // FIELD 9: sharedView
+    // Purpose: Optional shared-memory mirror for a live viewer process
+    // Value: Pointer to a SharedView (see shared_view.h), or NULL if disabled
+    struct SharedView *sharedView;
+    
+    // FIELD 10: quickLists
+    // Purpose: Deferred coalescing mode (see quick_lists.h)
+    // Value: Pointer to QuickLists, or NULL = merge holes on every free
+    struct QuickLists *quickLists;
+    
+    // FIELD 11: resizeStats
+    // Purpose: How many resizes stayed in place / moved, and KB copied
+    // Value: Counters, all 0 after initializeMemory()
+    ResizeStats resizeStats;
+    
+    // FIELD 12: admissionQueue
+    // Purpose: Failed requests wait here for space (see admission_queue.h)
+    // Value: Pointer to AdmissionQueue, or NULL = failed requests are dropped
+    struct AdmissionQueue *admissionQueue;
+
+    // FIELD 13: blockIndex
+    // Purpose: PID hash + largest-hole heap (see block_index.h)
+    // Value: Pointer to BlockIndex, or NULL = answer by walking the list
+    struct BlockIndex *blockIndex;
+
+    // FIELD 14: swapSpace
+    // Purpose: Backing store for swapped-out processes (see swap.h)
+    // Value: Pointer to SwapSpace, or NULL = no swapping
+    struct SwapSpace *swapSpace;
+
+    // FIELD 15: segments
+    // Purpose: Segment tables of segmented processes (see segmentation.h)
+    // Value: Pointer to SegmentManager, or NULL = one block per process
+    struct SegmentManager *segments;
+
+    // FIELD 16: firstHole
+    // Purpose: Start of the hole list (see MemoryBlock fields 15-16)
+    // Value: Lowest-address hole, or NULL if memory is full
+    // The fit algorithms follow nextHole from here, so they look at
+    // numHoles blocks instead of every block
+    MemoryBlock *firstHole;
+
+    // FIELD 17: holeTree
+    // Purpose: Holes sorted by address with subtree maxima (see hole_tree.h)
+    // Value: Pointer to HoleTree, or NULL = First Fit walks the hole list
+    struct HoleTree *holeTree;
+
+    // FIELD 18: bitmap
+    // Purpose: Bitmap backend (see bitmap_alloc.h)
+    // Value: Pointer to BitmapBackend, or NULL = use the block list
+    // When set, allocateMemory()/deallocateMemory() use the bitmap and
+    // the block list is not touched
+    struct BitmapBackend *bitmap;
+
+    // FIELD 19: addressIndex
+    // Purpose: All blocks sorted by address (see address_index.h)
+    // Value: Pointer to AddressIndex, or NULL = findBlockAt() walks the list
+    struct AddressIndex *addressIndex;
+
+    // FIELD 20: usageMap
+    // Purpose: Used KB per address bucket, for to-scale drawing (see usage_map.h)
+    // Value: Pointer to UsageMap, or NULL = none
+    struct UsageMap *usageMap;
+
+    // FIELD 21: defragmenter
+    // Purpose: Incremental compaction with a KB budget (see defrag.h)
+    // Value: Pointer to Defragmenter, or NULL = processes never move
+    struct Defragmenter *defragmenter;
+
+    // FIELD 22: compactPool
+    // Purpose: Compact backend - 16-byte blocks in one pool (see compact_blocks.h)
+    // Value: Pointer to CompactPool, or NULL = use the block list
+    // When set, allocateMemory()/deallocateMemory() use the pool and
+    // the block list is not touched
+    struct CompactPool *compactPool;
+
 } MemoryManager;
 
 
@@ -0,0 +1,192 @@
+/*
+================================================================================
+FILE: numa.h
+PURPOSE: NUMA - several memory nodes with different distances
+DESCRIPTION:
+    - A multi-socket machine has one memory node per socket; a CPU
+      reaches its own node faster than the others ("local" vs "remote")
+    - Each node is a normal MemoryManager over its own address range,
+      with its own hole index (largest hole in O(1))
+    - Every request names a preferred node; the fallback policy decides
+      where it goes when that node is full
+    - We count how often requests ended up remote and how fragmented
+      each node is, so placement policies can be compared
+================================================================================
+*/
+
+#ifndef NUMA_H
+#define NUMA_H
+
+#include "memory_manager.h"
+#include "block_index.h"
+
+#define MAX_NUMA_NODES 8
+#define NUMA_LOCAL_DISTANCE 10      // Same scale as the ACPI SLIT table
+#define NUMA_REMOTE_DISTANCE 20
+
+
+/*
+================================================================================
+ENUMERATION: NumaPolicy
+================================================================================
+PURPOSE: Where a request goes when its preferred node cannot take it
+
+NUMA_LOCAL_ONLY - Preferred node or nothing (the request fails)
+NUMA_NEAREST    - Preferred node, then the others by distance
+NUMA_INTERLEAVE - Ignore the preference: nodes take turns (round robin),
+                  which spreads memory evenly over all nodes
+*/
+
+typedef enum {
+    NUMA_LOCAL_ONLY,
+    NUMA_NEAREST,
+    NUMA_INTERLEAVE
+} NumaPolicy;
+
+
+/*
+================================================================================
+STRUCTURE: NumaNode
+================================================================================
+PURPOSE: One memory node and its counters
+
+ADDRESS RANGES: nodes follow each other in physical memory.
+EXAMPLE: OS 256 KB, nodes of 512 KB and 256 KB
+Node 0: 256 - 767   (mm: total 768, OS 256)
+Node 1: 768 - 1023  (mm: total 1024, "OS" 768 = everything before it)
+*/
+
+typedef struct NumaNode {
+    MemoryManager mm;       // Block list of this node only
+    BlockIndex index;       // Hole heap + PID table of this node
+    int size;               // KB of memory on this node
+
+    long localAllocs;       // Requests that preferred this node and got it
+    long remoteAllocs;      // Requests that preferred this node, placed elsewhere
+    long failedAllocs;      // Requests that preferred this node and failed
+    long servedForOthers;   // Requests placed here that preferred another node
+} NumaNode;
+
+
+/*
+================================================================================
+STRUCTURE: NumaSystem
+================================================================================
+PURPOSE: All nodes, their distances and the fallback policy
+
+distance[a][b] = cost for a CPU on node a to reach memory on node b
+(10 = local). fallbackOrder[a] lists every node sorted by that distance,
+so "nearest" never has to search.
+*/
+
+typedef struct NumaSystem {
+    NumaNode nodes[MAX_NUMA_NODES];
+    int numNodes;
+    int distance[MAX_NUMA_NODES][MAX_NUMA_NODES];
+    int fallbackOrder[MAX_NUMA_NODES][MAX_NUMA_NODES];
+    NumaPolicy policy;
+    int nextInterleave;     // Node whose turn it is (interleave policy)
+} NumaSystem;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initNuma
+--------------------------------------------------------------------------------
+PURPOSE: Create 'numNodes' nodes of nodeSizes[i] KB after 'osMemory' KB
+
+PARAMETERS:
+- distances: numNodes * numNodes values, row by row, or NULL for
+             10 on the diagonal and 20 everywhere else
+- policy: fallback policy (can be changed later in ns->policy)
+
+RETURNS: 1 on success, 0 on bad input or out of memory
+
+EXAMPLE: two sockets, node 1 is twice as far away
+int sizes[] = {512, 512};
+int dist[] = {10, 20,
+              20, 10};
+initNuma(&ns, sizes, 2, 256, dist, NUMA_NEAREST);
+*/
+int initNuma(NumaSystem *ns, const int nodeSizes[], int numNodes, int osMemory,
+             const int *distances, NumaPolicy policy);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: numaAllocate
+--------------------------------------------------------------------------------
+PURPOSE: Place a process, preferably on 'preferredNode'
+
+Each node is only tried if its largest hole is big enough (one look at
+its hole heap), so a full node costs nothing and prints no errors.
+
+RETURNS: Physical start address, or -1 if no allowed node had room
+*/
+int numaAllocate(NumaSystem *ns, int processID, int size, int preferredNode,
+                 AllocationAlgorithm algo);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: numaDeallocate / numaNodeOf
+--------------------------------------------------------------------------------
+numaDeallocate - Free a process on whichever node holds it.
+                 Returns 1 on success, 0 if not found
+numaNodeOf     - Node that holds 'processID', or -1
+*/
+int numaDeallocate(NumaSystem *ns, int processID);
+int numaNodeOf(NumaSystem *ns, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: numaRemoteRatio
+--------------------------------------------------------------------------------
+PURPOSE: Share of placed requests that did not get their preferred node
+
+RETURNS: 0.0 - 1.0 (0.0 if nothing was placed yet)
+*/
+double numaRemoteRatio(NumaSystem *ns);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayNumaStats / freeNuma
+--------------------------------------------------------------------------------
+EXAMPLE OUTPUT:
+NUMA (nearest), 2 nodes
+Node  Range        Free    Frag     Local  Remote  Failed  Served
+0     256-767      12 KB   1.56%    40     8       0       0
+1     768-1279     300 KB  10.20%   20     0       0       8
+Remote allocations: 8 of 68 (11.76%)
+*/
+void displayNumaStats(NumaSystem *ns);
+void freeNuma(NumaSystem *ns);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: runNumaWorkload
+--------------------------------------------------------------------------------
+PURPOSE: Random allocations and frees, the same for every policy
+
+Step i is process i: one step in three frees a random live process,
+the others allocate 1 - maxSize KB. Requests come from CPUs on every
+node in turn (preferred node = pid % numNodes), so a node smaller than
+the others fills up first and its requests start going remote.
+Same seed → same requests.
+
+RETURNS: Number of processes placed
+*/
+long runNumaWorkload(NumaSystem *ns, int numOps, int maxSize, unsigned int seed,
+                     AllocationAlgorithm algo);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: numa.h
+================================================================================
+*/
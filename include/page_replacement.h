@@ -0,0 +1,177 @@
+/*
+================================================================================
+FILE: page_replacement.h
+PURPOSE: Replay a page reference string under a page replacement policy
+DESCRIPTION:
+    - Once memory is full of pages, a new page must push one out
+    - Which one to push out is the replacement policy: LRU, CLOCK,
+      second chance or ARC
+    - Every access costs O(1): a hash map finds the page, intrusive
+      linked lists keep the order - no searching
+    - References can be fed in chunks, so logs with billions of
+      accesses can be streamed from disk
+================================================================================
+*/
+
+#ifndef PAGE_REPLACEMENT_H
+#define PAGE_REPLACEMENT_H
+
+
+/*
+================================================================================
+ENUMERATION: ReplacementPolicy
+================================================================================
+REPLACE_LRU:           Evict the page used longest ago
+REPLACE_CLOCK:         Frames in a circle with a "referenced" bit; the
+                       hand clears set bits and evicts the first clear one
+REPLACE_SECOND_CHANCE: FIFO queue; a referenced page at the front gets
+                       its bit cleared and goes to the back once
+                       (same choices as CLOCK, kept as a queue)
+REPLACE_ARC:           Adaptive Replacement Cache - balances "used once
+                       recently" against "used often", remembering
+                       recently evicted pages (ghosts) to tune itself
+*/
+
+typedef enum {
+    REPLACE_LRU,
+    REPLACE_CLOCK,
+    REPLACE_SECOND_CHANCE,
+    REPLACE_ARC
+} ReplacementPolicy;
+
+
+/*
+================================================================================
+STRUCTURES: PageNode / PageList
+================================================================================
+PURPOSE: Intrusive lists - the links live inside the nodes, and nodes
+are array slots, so "move to front" is a few index writes, no malloc.
+*/
+
+typedef struct PageNode {
+    unsigned int page;      // Page number
+    int prev;               // Node index, -1 = none
+    int next;
+    unsigned char list;     // Which list it is on (ARC: T1, T2, B1, B2)
+    unsigned char referenced;
+} PageNode;
+
+typedef struct PageList {
+    int head;               // Most recently added / used
+    int tail;               // Next to evict
+    int size;
+} PageList;
+
+
+/*
+================================================================================
+STRUCTURE: ReplacementSim
+================================================================================
+PURPOSE: Frames, lookup table and counters of one replay
+
+THE HASH MAP:
+Open addressing (linear probing) from page number to node index, at most
+half full. Removal shifts later entries back, so no "deleted" markers
+slow the lookups down over time.
+*/
+
+typedef struct ReplacementSim {
+    ReplacementPolicy policy;
+    int numFrames;
+
+    PageNode *nodes;        // numFrames (ARC: 2 * numFrames, incl. ghosts)
+    int numNodes;
+    int freeNode;           // Chain of unused nodes through 'next'
+
+    unsigned int *hashPages;
+    int *hashNodes;         // -1 = empty slot
+    unsigned int hashMask;
+
+    PageList lists[4];      // LRU/FIFO use lists[0]; ARC uses all four
+    int clockHand;          // CLOCK: node the hand points at
+    int arcTarget;          // ARC: 'p', the target size of T1
+
+    // Statistics
+    long long references;
+    long long faults;
+    long long evictions;
+} ReplacementSim;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initReplacement / freeReplacement
+--------------------------------------------------------------------------------
+PURPOSE: Empty frames for a replay ('numFrames' e.g. from a PagingSystem)
+
+RETURNS: 1 on success, 0 on bad frame count or out of memory
+*/
+int initReplacement(ReplacementSim *rs, ReplacementPolicy policy, int numFrames);
+void freeReplacement(ReplacementSim *rs);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: replayReferences
+--------------------------------------------------------------------------------
+PURPOSE: Access 'n' pages in order (may be called again with the next chunk)
+
+RETURNS: Page faults caused by this chunk
+
+EXAMPLE:
+unsigned int refs[] = {1, 2, 3, 1, 4, 5};
+ReplacementSim rs;
+initReplacement(&rs, REPLACE_LRU, 3);
+replayReferences(&rs, refs, 6);     // 5 faults (1 hits)
+*/
+long long replayReferences(ReplacementSim *rs, const unsigned int pages[], long long n);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: replayReferenceFile
+--------------------------------------------------------------------------------
+PURPOSE: Replay a binary access log (32-bit page numbers, native byte
+order) in chunks of 1M references
+
+RETURNS: Page faults, or -1 if the file cannot be read
+*/
+long long replayReferenceFile(ReplacementSim *rs, const char *path);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: loadReferenceFile
+--------------------------------------------------------------------------------
+PURPOSE: Read a whole binary access log into memory (same format as
+         replayReferenceFile); a trailing partial reference is ignored
+
+RETURNS: The references (caller frees) with *n set, or NULL if the file
+         cannot be read
+*/
+unsigned int *loadReferenceFile(const char *path, long long *n);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayReplacementStats / compareReplacementPolicies
+--------------------------------------------------------------------------------
+compareReplacementPolicies replays the same string under every policy
+and prints one row each.
+
+EXAMPLE OUTPUT:
+Policy         Faults     Fault rate
+LRU            412        41.20%
+CLOCK          420        42.00%
+*/
+void displayReplacementStats(ReplacementSim *rs);
+void compareReplacementPolicies(const unsigned int pages[], long long n, int numFrames);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: page_replacement.h
+================================================================================
+*/
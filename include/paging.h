@@ -0,0 +1,145 @@
+/*
+================================================================================
+FILE: paging.h
+PURPOSE: Paging - the non-contiguous alternative to partitions
+DESCRIPTION:
+    - User memory is cut into equal frames (e.g. 16 KB each)
+    - A process gets as many frames as it needs, wherever they are free;
+      its page table maps page N → frame F
+    - No external fragmentation (any free frame will do), but the last
+      page of a process is usually not full: internal fragmentation
+    - Runs over the same user region as a MemoryManager so both can be
+      compared on one workload
+================================================================================
+*/
+
+#ifndef PAGING_H
+#define PAGING_H
+
+#include "memory_manager.h"
+
+
+/*
+================================================================================
+STRUCTURE: PageTable
+================================================================================
+PURPOSE: Where each page of one process lives
+
+EXAMPLE: P1 needs 40 KB with 16 KB pages → 3 pages, 8 KB wasted
+frames = {0, 5, 6}
+Page 0 → Frame 0, Page 1 → Frame 5, Page 2 → Frame 6
+*/
+
+typedef struct PageTable {
+    int processID;
+    int size;               // KB actually requested
+    int numPages;
+    int *frames;            // frames[page] = frame number
+} PageTable;
+
+
+/*
+================================================================================
+STRUCTURE: PagingSystem
+================================================================================
+PURPOSE: Frame bitmap plus every page table
+
+THE FRAME BITMAP:
+One bit per frame (1 = used), 64 frames per word. A free frame is found
+by skipping full words (all ones) and then counting the trailing ones
+of the first word that is not full - one instruction on most CPUs.
+'firstFreeWord' remembers where the search can start: no word before it
+has a free frame.
+*/
+
+typedef struct PagingSystem {
+    int pageSize;           // KB per page / frame
+    int baseAddress;        // Physical address of frame 0 (end of OS)
+    int numFrames;
+    int freeFrames;
+
+    unsigned long long *frameBitmap;
+    int numWords;
+    int firstFreeWord;
+
+    PageTable *tables;      // One per resident process
+    int numTables;
+    int tableCapacity;
+
+    int internalWaste;      // KB allocated but not requested (last pages)
+} PagingSystem;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initPaging
+--------------------------------------------------------------------------------
+PURPOSE: Cut the user region of 'mm' into frames of 'pageSize' KB
+
+Only the region is taken from mm (osMemory .. totalMemory-1); the two
+keep separate bookkeeping. A tail smaller than one page is not used.
+
+RETURNS: 1 on success, 0 on bad page size or out of memory
+*/
+int initPaging(PagingSystem *ps, const MemoryManager *mm, int pageSize);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: pagingAllocate / pagingFree
+--------------------------------------------------------------------------------
+pagingAllocate - Give 'processID' ceil(size / pageSize) frames.
+                 Returns the physical address of page 0, or -1 if
+                 there are not enough free frames (nothing is taken)
+pagingFree     - Give all its frames back. Returns 1, or 0 if not found
+*/
+int pagingAllocate(PagingSystem *ps, int processID, int size);
+int pagingFree(PagingSystem *ps, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: translateAddress
+--------------------------------------------------------------------------------
+PURPOSE: Logical address (KB offset inside the process) → physical
+
+EXAMPLE: 16 KB pages, frames = {0, 5, 6}, base 256
+Logical 20 → page 1, offset 4 → frame 5 → 256 + 5*16 + 4 = 340
+
+RETURNS: Physical address, or -1 if out of range / not found
+*/
+int translateAddress(PagingSystem *ps, int processID, int logicalAddress);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: pagingFragmentation
+--------------------------------------------------------------------------------
+PURPOSE: Internal fragmentation as % of user memory
+
+Comparable to calculateFragmentation(), which measures external
+fragmentation of partitions against the same user memory.
+*/
+float pagingFragmentation(PagingSystem *ps);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayPaging / freePaging
+--------------------------------------------------------------------------------
+EXAMPLE OUTPUT:
+Frames: [111111122222...]   (process number per frame, . = free)
+P1: 100 KB in 7 pages (12 KB unused) → frames 0-6
+Free frames: 14 / 48 | Internal fragmentation: 44 KB (5.73%)
+*/
+void displayPaging(PagingSystem *ps);
+void freePaging(PagingSystem *ps);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: paging.h
+================================================================================
+*/
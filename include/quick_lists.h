@@ -0,0 +1,118 @@
+/*
+================================================================================
+FILE: quick_lists.h
+PURPOSE: Deferred (lazy) coalescing with exact-size quick lists
+DESCRIPTION:
+    - Normally deallocateMemory() merges a freed block with its neighbours
+      right away. If the next request has the same size, that merge is
+      immediately undone by a split - wasted work.
+    - In deferred mode a freed block stays a separate hole and is pushed
+      on a "quick list" for its exact size. The next request of that size
+      takes it directly: no search, no split.
+    - Holes are merged later, all at once, by a "sweep": when an
+      allocation fails, or when too many freed blocks are waiting.
+================================================================================
+*/
+
+#ifndef QUICK_LISTS_H
+#define QUICK_LISTS_H
+
+#include "memory_structures.h"
+
+
+/*
+================================================================================
+STRUCTURE: QuickLists
+================================================================================
+PURPOSE: One list per exact size, plus hit/miss statistics
+
+THINK OF IT LIKE:
+A cloakroom with one hook per coat size. Returned coats go on their
+hook; the next customer with that size gets one straight off the hook.
+
+heads[s] is the most recently freed hole of exactly s KB. Only sizes
+up to maxCachedSize get a list; bigger frees are merged immediately.
+*/
+
+typedef struct QuickLists {
+    MemoryBlock **heads;        // heads[0..maxCachedSize]
+    int maxCachedSize;          // Largest size (KB) that is cached
+    int sweepThreshold;         // Sweep when this many holes are cached
+    int numCached;              // Holes currently on quick lists
+
+    // Statistics
+    long hits;                  // Allocations served from a quick list
+    long misses;                // Allocations that had to search
+    long sweeps;                // Number of merge sweeps
+    long sweepMerges;           // Holes merged by all sweeps together
+} QuickLists;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableDeferredCoalescing
+--------------------------------------------------------------------------------
+PURPOSE: Switch 'mm' into deferred coalescing mode
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- lists: Storage for the quick lists (caller owns it)
+- maxCachedSize: Frees up to this size (KB) are cached
+- sweepThreshold: Run a merge sweep once this many holes are cached
+
+RETURNS: 1 on success, 0 if out of memory
+
+EXAMPLE CALL:
+QuickLists lists;
+enableDeferredCoalescing(&mm, &lists, 256, 64);
+*/
+int enableDeferredCoalescing(MemoryManager *mm, QuickLists *lists,
+                             int maxCachedSize, int sweepThreshold);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: disableDeferredCoalescing
+--------------------------------------------------------------------------------
+PURPOSE: Merge everything that is waiting and go back to eager merging
+*/
+void disableDeferredCoalescing(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTIONS USED BY memory_manager.c
+--------------------------------------------------------------------------------
+takeQuickBlock   - Pop a hole of exactly 'size' KB (counts a hit or a miss)
+cacheFreedBlock  - Push a just-freed hole; returns 0 if it should be merged
+                   normally instead (too big, or mode is off)
+forgetQuickBlock - Remove a hole from its list before it is split or merged
+sweepQuickLists  - Merge all neighbouring holes and empty every list;
+                   returns how many merges happened
+*/
+MemoryBlock *takeQuickBlock(MemoryManager *mm, int size);
+int cacheFreedBlock(MemoryManager *mm, MemoryBlock *block);
+void forgetQuickBlock(MemoryManager *mm, MemoryBlock *block);
+int sweepQuickLists(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayQuickListStats
+--------------------------------------------------------------------------------
+PURPOSE: Print hit rate and sweep counts
+
+EXAMPLE OUTPUT:
+Quick list hits: 900 / 1000 (90.00%)
+Sweeps: 3 (merged 120 holes) | Cached now: 14
+*/
+void displayQuickListStats(MemoryManager *mm);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: quick_lists.h
+================================================================================
+*/
@@ -0,0 +1,72 @@
+/*
+================================================================================
+FILE: resize.h
+PURPOSE: Change the size of a process that is already in memory
+DESCRIPTION:
+    - Without this, growing a process means deallocate + allocate, which
+      in a real system copies the whole partition every time
+    - resizeMemory() tries the cheap options first and only moves
+      (copies) the process when nothing else works
+================================================================================
+*/
+
+#ifndef RESIZE_H
+#define RESIZE_H
+
+#include "memory_manager.h"
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: resizeMemory
+--------------------------------------------------------------------------------
+PURPOSE: Give process 'processID' exactly 'newSize' KB (like realloc)
+
+TRIED IN THIS ORDER:
+1. SHRINK IN PLACE   - cut the unused tail off as a new hole
+                       (merged with the next block if that is a hole)
+2. GROW IN PLACE     - absorb the hole right after the process
+3. SLIDE DOWN        - absorb the hole before (and after) the process;
+                       the process moves to the lower address
+4. RELOCATE          - First Fit elsewhere, then free the old block
+
+Options 1-2 copy nothing. Options 3-4 copy the old contents (old size
+in KB), which is added to mm->resizeStats.kbCopied.
+
+PARAMETERS:
+- mm: Pointer to MemoryManager
+- processID: Process to resize
+- newSize: New size in KB
+
+RETURNS:
+- Start address of the process after the resize
+- -1 if the process does not exist or no space was found
+  (the process is then left unchanged), or the bitmap backend is on
+
+EXAMPLE:
+Before: [P1: 256-355][HOLE: 356-455][P2...]
+resizeMemory(&mm, 1, 150);
+After:  [P1: 256-405][HOLE: 406-455][P2...]   (returns 256, 0 KB copied)
+*/
+int resizeMemory(MemoryManager *mm, int processID, int newSize);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayResizeStats
+--------------------------------------------------------------------------------
+PURPOSE: Print in-place vs moved resizes and KB copied
+
+EXAMPLE OUTPUT:
+Resizes: 40 in place, 2 moved (300 KB copied)
+*/
+void displayResizeStats(MemoryManager *mm);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: resize.h
+================================================================================
+*/
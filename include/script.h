@@ -0,0 +1,162 @@
+/*
+================================================================================
+FILE: script.h
+PURPOSE: Run a file of commands with no prompts - for batch jobs
+DESCRIPTION:
+    - The menu needs a person (or piped keystrokes) for every step
+    - A script is a plain text file, one command per line; the runner
+      executes it top to bottom without banners, prompts or pauses
+    - Every command answers with one line of "key=value" fields, so the
+      output can be read by another program (awk, Python, a dashboard)
+    - Started from the command line: memory_visualizer --script FILE
+================================================================================
+*/
+
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include <stdio.h>
+#include "memory_manager.h"
+
+
+/*
+================================================================================
+SCRIPT COMMANDS
+================================================================================
+alloc <pid> <size> [first|best|worst]   Allocate (default: --policy)
+      [align=<KB>]                      With align: start at a multiple of
+                                        <KB>; the KB skipped before it stay
+                                        a hole (aligned_alloc.h)
+free <pid> [<pid> ...]                  Deallocate by process ID; several
+                                        at once are freed in one pass
+                                        (fail unless every one was in memory)
+freeat <address>                        Deallocate by start address
+resize <pid> <size>                     Change a process's size
+touch <pid>                             Mark a process as just used, for
+                                        --swap lru (fail if not in memory)
+swapin <pid> [first|best|worst]         Bring a swapped-out process back
+                                        (fail if it is not swapped out)
+segalloc <pid> <size> [<size> ...]      Place a process as 1-8 segments,
+         [first|best|worst]             all or nothing (segmentation.h);
+                                        "free <pid>" frees every segment
+segshow <pid>                           One "segment ... base= limit=" line
+                                        per entry of the segment table
+segaddr <pid> <segment> <offset>        Physical address of an offset in a
+                                        segment (fail past the limit)
+policy <first|best|worst>               Change the default algorithm
+show                                    Every block, then the totals
+stats                                   Totals only
+reset                                   Empty memory, same sizes
+
+Blank lines and lines starting with '#' are skipped.
+
+EXAMPLE SCRIPT:            EXAMPLE OUTPUT:
+alloc 1 100                alloc line=1 pid=1 size=100 algo=first result=ok address=256
+alloc 2 900                alloc line=2 pid=2 size=900 algo=first result=fail
+free 1                     free line=3 pid=1 result=ok
+stats                      stats line=4 processes=0 holes=1 free=768 fragmentation=0.00
+                           summary commands=4 ok=3 failed=1 errors=0
+
+"result=fail" means the allocator said no (a normal outcome). A line
+the runner can't understand prints "error line=N message=..." instead -
+also a number that is not a whole word or does not fit in an int
+("alloc 1 100k", "alloc 1 99999999999").
+
+The same results can be written as NDJSON or CSV records instead
+(--format, see stream_output.h): one "event" per command, a "state"
+with every block for "show", then "error" and "summary" records.
+*/
+
+
+/*
+================================================================================
+ENUMERATION: ScriptFormat
+================================================================================
+*/
+
+typedef enum {
+    SCRIPT_TEXT,            // key=value lines (above)
+    SCRIPT_NDJSON,          // One JSON object per line
+    SCRIPT_CSV              // One CSV row per line, with a header
+} ScriptFormat;
+
+
+/*
+================================================================================
+STRUCTURE: ScriptStats
+================================================================================
+PURPOSE: What happened over a whole script (also the "summary" line)
+*/
+
+typedef struct ScriptStats {
+    long commands;          // Lines that were commands
+    long succeeded;         // result=ok
+    long failed;            // result=fail
+    long errors;            // Lines that could not be run at all
+} ScriptStats;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: runScript
+--------------------------------------------------------------------------------
+PURPOSE: Execute every command in 'in' against a fresh memory of
+         totalMemory KB (osMemory KB of it for the OS), writing results
+         to 'out'
+
+PARAMETERS:
+- bitmapUnit: 0 = the block list; N > 0 = a bitmap of N KB units
+  (bitmap_alloc.h). "resize" and "alloc ... align=" then always fail -
+  they need blocks
+- compactBlocks: -1 = the block list; N >= 0 = a compact pool of
+  16-byte blocks sized for N of them (compact_blocks.h; 0 = grow as
+  needed). Same placements and "show" lines as the block list;
+  "resize", "alloc ... align=" and "segalloc" always fail
+- swapPolicy: -1 = no swapping; else a SwapPolicy (swap.h). An "alloc"
+  that does not fit swaps processes out, and "show" / "stats" end with
+  "swapped=N"
+- defragBudget: 0 = off; N > 0 = one defragmenter step of up to N KB per
+  operation (defrag.h), as MAV_DEFRAG does in the menu. Ignored with
+  the bitmap or the compact pool
+
+RETURNS: 1 if every line was understood, 0 if any "error" line was
+         written (the rest of the script still runs)
+
+EXAMPLE:
+FILE *in = fopen("workload.txt", "r");
+ScriptStats stats;
+runScript(in, stdout, 1024, 256, 0, -1, -1, 0, FIRST_FIT, SCRIPT_TEXT, &stats);
+*/
+int runScript(FILE *in, FILE *out, int totalMemory, int osMemory, int bitmapUnit,
+              int compactBlocks, int swapPolicy, int defragBudget, AllocationAlgorithm policy,
+              ScriptFormat format, ScriptStats *stats);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: parsePolicy / policyName / parseFormat / parseSwapPolicy /
+          parseReplacementPolicy / parseNumaPolicy
+--------------------------------------------------------------------------------
+parsePolicy     - "first" / "best" / "worst" → 0 / 1 / 2, or -1 if unknown
+policyName      - The reverse
+parseFormat     - "text" / "ndjson" / "csv" → ScriptFormat, or -1 if unknown
+parseSwapPolicy - "lru" / "largest" / "fewest" → SwapPolicy, or -1 if unknown
+parseReplacementPolicy - "lru" / "clock" / "second" / "arc" →
+                  ReplacementPolicy, or -1 if unknown
+parseNumaPolicy - "local" / "nearest" / "interleave" → NumaPolicy, or -1
+*/
+int parsePolicy(const char *name);
+const char *policyName(AllocationAlgorithm algo);
+int parseFormat(const char *name);
+int parseSwapPolicy(const char *name);
+int parseReplacementPolicy(const char *name);
+int parseNumaPolicy(const char *name);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: script.h
+================================================================================
+*/
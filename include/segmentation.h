@@ -0,0 +1,161 @@
+/*
+================================================================================
+FILE: segmentation.h
+PURPOSE: Segmentation - one process, several separate blocks
+DESCRIPTION:
+    - Real programs are not one lump: code, data, heap and stack are
+      separate segments that can live anywhere in memory
+    - Each segment is placed by the normal fit algorithms
+    - A segment table per process maps segment number → (base, limit)
+    - A group of segments is placed all-or-nothing
+    - Freeing the process frees every segment through its table
+================================================================================
+*/
+
+#ifndef SEGMENTATION_H
+#define SEGMENTATION_H
+
+#include "memory_manager.h"
+#include "block_index.h"
+#include "address_index.h"
+
+#define MAX_SEGMENTS 8
+#define SEGMENT_NAME_LENGTH 8
+
+
+/*
+================================================================================
+STRUCTURE: Segment / SegmentTable
+================================================================================
+PURPOSE: The segment table of one process
+
+EXAMPLE: P3 = code 40 KB, data 60 KB, stack 20 KB
+Segment  Name   Base  Limit
+0        code   256   40
+1        data   420   60
+2        stack  700   20
+Logical (segment 1, offset 10) → physical 430
+*/
+
+typedef struct Segment {
+    char name[SEGMENT_NAME_LENGTH];
+    MemoryBlock *block;     // Base = block->startAddress, limit = block->size
+} Segment;
+
+typedef struct SegmentTable {
+    int processID;
+    int numSegments;
+    Segment segments[MAX_SEGMENTS];
+    struct SegmentTable *next;      // Next table in the same hash bucket
+} SegmentTable;
+
+
+/*
+================================================================================
+STRUCTURE: SegmentManager
+================================================================================
+PURPOSE: All segment tables, found by PID in O(1)
+
+buckets[hash(pid)] chains the tables through 'next'; the table doubles
+when it holds more tables than buckets.
+
+Placing a segment needs two more lookups, so both indexes are attached
+if mm does not have them yet:
+- "is P already in memory?" → BlockIndex (PID table), O(1)
+- "which block did allocateMemory() just fill?" → AddressIndex,
+  findBlockAt(returned address), O(log n)
+*/
+
+typedef struct SegmentManager {
+    SegmentTable **buckets;
+    int numBuckets;         // Always a power of 2
+    int numTables;
+
+    BlockIndex index;           // Used if mm had no BlockIndex of its own
+    AddressIndex addresses;     // Used if mm had no AddressIndex of its own
+    int ownsIndex;
+    int ownsAddresses;
+} SegmentManager;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableSegmentation / disableSegmentation
+--------------------------------------------------------------------------------
+PURPOSE: Attach segment tables to mm (caller owns 'sm')
+
+Attaches a BlockIndex and an AddressIndex too if mm does not have them
+yet; disabling drops those again. Disabling keeps the blocks in memory
+but forgets which belong together.
+
+RETURNS: 1 on success, 0 if out of memory or the bitmap backend is on
+         (segment tables point at blocks of the block list)
+*/
+int enableSegmentation(MemoryManager *mm, SegmentManager *sm);
+void disableSegmentation(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: allocateSegments
+--------------------------------------------------------------------------------
+PURPOSE: Place n segments for one process, all or nothing
+
+The largest segments are placed first (they are the hardest to fit).
+If any segment fails, the ones already placed are freed again and
+memory looks as before.
+
+PARAMETERS:
+- sizes: n segment sizes in KB
+- names: n names ("code", "data", ...), or NULL for "S0", "S1", ...
+- algo: FIRST_FIT, BEST_FIT or WORST_FIT (used for every segment)
+
+RETURNS: n on success, -1 on failure
+
+EXAMPLE:
+int sizes[] = {40, 60, 20};
+const char *names[] = {"code", "data", "stack"};
+allocateSegments(&mm, 3, sizes, names, 3, BEST_FIT);
+*/
+int allocateSegments(MemoryManager *mm, int processID, const int sizes[],
+                     const char *names[], int n, AllocationAlgorithm algo);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: deallocateSegments
+--------------------------------------------------------------------------------
+PURPOSE: Free every segment of 'processID' (one table lookup, no scan)
+
+deallocateMemory() calls this when the process has a segment table.
+
+RETURNS: 1 if the process had segments, 0 otherwise
+*/
+int deallocateSegments(MemoryManager *mm, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+LOOKUPS
+--------------------------------------------------------------------------------
+findSegmentTable        - Table of 'processID', or NULL
+translateSegmentAddress - (segment, offset) → physical address, or -1
+                          if the offset is past the limit (a
+                          "segmentation fault")
+forgetSegmentTable      - Drop the table only (its blocks were already
+                          freed, e.g. by deallocateBatch)
+displaySegmentTable     - Print one process's table
+*/
+SegmentTable *findSegmentTable(MemoryManager *mm, int processID);
+int translateSegmentAddress(MemoryManager *mm, int processID, int segment, int offset);
+void forgetSegmentTable(MemoryManager *mm, int processID);
+void displaySegmentTable(MemoryManager *mm, int processID);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: segmentation.h
+================================================================================
+*/
@@ -0,0 +1,176 @@
+/*
+================================================================================
+FILE: shared_view.h
+PURPOSE: Mirror the block table into POSIX shared memory for live viewers
+DESCRIPTION:
+    - The simulator (writer) copies its blocks into a shared segment
+    - A separate viewer process (reader) maps the same segment and draws it
+    - A "seqlock" lets the reader get a consistent copy without ever
+      making the writer wait
+================================================================================
+*/
+
+#ifndef SHARED_VIEW_H
+#define SHARED_VIEW_H
+
+#include <stddef.h>
+#include "memory_structures.h"
+
+
+/*
+================================================================================
+HOW THE SEQLOCK WORKS
+================================================================================
+The segment has a counter called 'sequence'.
+
+WRITER (never blocks):
+1. sequence++        → now ODD  ("I'm writing, don't trust the data")
+2. copy the blocks
+3. sequence++        → now EVEN ("data is complete")
+
+READER (retries if unlucky):
+1. s1 = sequence     (if ODD, the writer is busy → try again)
+2. copy the blocks
+3. s2 = sequence     (if s1 != s2, the writer changed data → try again)
+
+The writer does no formatting and takes no lock, so mirroring costs
+about one memcpy of the block table per publish.
+*/
+
+
+// Magic number "MAVS" so a reader can tell it opened the right segment
+#define SHARED_VIEW_MAGIC   0x4D415653u
+#define SHARED_VIEW_VERSION 1
+
+
+/*
+================================================================================
+STRUCTURE: SharedBlock
+================================================================================
+PURPOSE: One block as stored in shared memory (12 bytes)
+*/
+
+typedef struct SharedBlock {
+    int startAddress;
+    int size;
+    int processID;      // -1 for a hole
+} SharedBlock;
+
+
+/*
+================================================================================
+STRUCTURE: SharedViewStats
+================================================================================
+PURPOSE: The MemoryManager counters that travel with the blocks
+*/
+
+typedef struct SharedViewStats {
+    int totalMemory;
+    int osMemory;
+    int freeMemory;
+    int numProcesses;
+    int numHoles;
+    int numBlocks;          // Blocks copied into the segment
+    int totalBlocks;        // Blocks that exist (> numBlocks if truncated)
+    unsigned int publishCount;
+} SharedViewStats;
+
+
+/*
+================================================================================
+STRUCTURE: SharedView
+================================================================================
+PURPOSE: One process's handle on a shared segment (writer or reader)
+
+The segment itself is private to shared_view.c; callers only use this
+handle and the functions below.
+*/
+
+typedef struct SharedView {
+    char name[64];              // Segment name, e.g. "/mav_view"
+    int fd;                     // File descriptor from shm_open
+    size_t bytes;               // Size of the mapping
+    struct SharedViewSegment *segment;
+    int isWriter;               // 1 = created it (simulator), 0 = viewer
+
+    // Writer only: publish every N operations (1 = after every change)
+    int publishEvery;
+    int opsSincePublish;
+} SharedView;
+
+
+/*
+--------------------------------------------------------------------------------
+WRITER SIDE
+--------------------------------------------------------------------------------
+*/
+
+/*
+FUNCTION: createSharedView
+PURPOSE: Create (or replace) a shared segment with room for 'capacity' blocks
+PARAMETERS:
+- view: Handle to fill in
+- name: POSIX shm name, must start with '/' (example: "/mav_view")
+- capacity: Maximum blocks mirrored (extra blocks are counted, not copied)
+- publishEvery: Mirror after every N allocate/deallocate calls
+RETURNS: 1 on success, 0 on failure (message printed)
+*/
+int createSharedView(SharedView *view, const char *name, int capacity,
+                     int publishEvery);
+
+/*
+FUNCTION: attachSharedView
+PURPOSE: Make 'mm' mirror itself into 'view' (NULL stops mirroring)
+Publishes the current state immediately.
+*/
+void attachSharedView(MemoryManager *mm, SharedView *view);
+
+/*
+FUNCTION: publishSharedView
+PURPOSE: Called by memory_manager.c after each successful change
+Copies the block table once every 'publishEvery' calls.
+'force' = 1 copies right now regardless of the counter.
+*/
+void publishSharedView(MemoryManager *mm, int force);
+
+
+/*
+--------------------------------------------------------------------------------
+READER SIDE
+--------------------------------------------------------------------------------
+*/
+
+/*
+FUNCTION: openSharedView
+PURPOSE: Map an existing segment read-only (used by the viewer)
+RETURNS: 1 on success, 0 if the segment does not exist or is invalid
+*/
+int openSharedView(SharedView *view, const char *name);
+
+/*
+FUNCTION: readSharedView
+PURPOSE: Copy a consistent snapshot (retries while the writer is busy)
+PARAMETERS:
+- out: Array for the blocks
+- maxBlocks: Size of 'out'
+- stats: Receives the counters (numBlocks = blocks written to 'out')
+RETURNS: Number of retries needed (0 = first try was consistent)
+*/
+int readSharedView(SharedView *view, SharedBlock *out, int maxBlocks,
+                   SharedViewStats *stats);
+
+
+/*
+FUNCTION: closeSharedView
+PURPOSE: Unmap the segment; the writer also removes its name
+*/
+void closeSharedView(SharedView *view);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: shared_view.h
+================================================================================
+*/
@@ -0,0 +1,187 @@
+/*
+================================================================================
+FILE: simulation.h
+PURPOSE: Discrete-event simulation of processes arriving and leaving
+DESCRIPTION:
+    - Each process has an arrival time, a size and a duration
+    - The engine jumps from event to event (no real waiting) and calls
+      allocateMemory() / deallocateMemory() automatically
+    - Used to study steady-state fragmentation under churn instead of
+      driving every allocation by hand
+================================================================================
+*/
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "memory_manager.h"
+#include "stream_output.h"
+
+
+/*
+================================================================================
+STRUCTURE: SimProcess
+================================================================================
+PURPOSE: One process of the workload
+*/
+
+typedef struct SimProcess {
+    int processID;          // Set to 1..n (arrival order) by initSimulation()
+    double arrivalTime;     // When it asks for memory
+    int size;               // KB
+    double duration;        // How long it stays once it has memory
+} SimProcess;
+
+
+/*
+================================================================================
+STRUCTURE: SimEvent
+================================================================================
+PURPOSE: One entry of the event heap
+
+SIM_DEPARTURE sorts before SIM_ARRIVAL at the same time, so memory
+freed at time t is available to a process arriving at time t.
+*/
+
+typedef enum {
+    SIM_DEPARTURE,
+    SIM_ARRIVAL
+} SimEventType;
+
+typedef struct SimEvent {
+    double time;
+    SimEventType type;
+    int index;              // Index into the process array
+} SimEvent;
+
+
+/*
+================================================================================
+STRUCTURE: Simulation
+================================================================================
+PURPOSE: Engine state
+
+THE EVENT HEAP:
+A min-heap ordered by time: the next event is always at heap[0], and
+adding or removing an event costs O(log n). Only the NEXT arrival is in
+the heap at any time (processes are sorted by arrival), so the heap
+holds at most (running processes + 1) events.
+*/
+
+typedef struct Simulation {
+    MemoryManager *mm;
+    AllocationAlgorithm algo;
+
+    SimProcess *processes;  // Sorted by arrival time
+    int numProcesses;
+    int nextArrival;        // Next process to arrive
+
+    SimEvent *heap;
+    int heapSize;
+    int heapCapacity;
+
+    double now;             // Simulated time
+
+    // Statistics
+    long eventsProcessed;
+    long allocated;         // Placed on arrival
+    long admittedLate;      // Placed later by the admission queue
+    long rejected;          // Could not be placed (and did not wait)
+    int sampleInterval;     // Sample fragmentation every N events
+    long fragmentationSamples;
+    double fragmentationSum;
+    double cpuSeconds;      // Real time spent in runSimulation()
+
+    // Optional: one "arrive" / "depart" record per event (NULL = off,
+    // set it after initSimulation()). An arrival that has to wait in
+    // the admission queue is recorded with ok = false
+    StreamWriter *stream;
+} Simulation;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: generateWorkload
+--------------------------------------------------------------------------------
+PURPOSE: Fill 'processes' with a random, reproducible workload
+
+- Time between arrivals: exponential with mean 'meanInterarrival'
+- Duration: exponential with mean 'meanDuration'
+- Size: uniform in [minSize, maxSize] KB
+Same seed → same workload.
+*/
+void generateWorkload(SimProcess processes[], int n, unsigned int seed,
+                      double meanInterarrival, double meanDuration,
+                      int minSize, int maxSize);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initSimulation
+--------------------------------------------------------------------------------
+PURPOSE: Prepare a run over 'processes' (the array is sorted in place)
+
+If mm has an admission queue, processes that do not fit wait in it and
+depart 'duration' after they are finally admitted.
+
+RETURNS: 1 on success, 0 if out of memory
+*/
+int initSimulation(Simulation *sim, MemoryManager *mm, SimProcess processes[],
+                   int n, AllocationAlgorithm algo);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: runSimulation
+--------------------------------------------------------------------------------
+PURPOSE: Process events until simulated time passes 'untilTime'
+
+PARAMETERS:
+- untilTime: Stop time, or a negative value to run until no events remain
+
+RETURNS: Number of events processed by this call
+
+EXAMPLE:
+SimProcess procs[100000];
+Simulation sim;
+generateWorkload(procs, 100000, 42, 1.0, 50.0, 4, 64);
+initSimulation(&sim, &mm, procs, 100000, FIRST_FIT);
+runSimulation(&sim, -1);
+displaySimulationStats(&sim);
+freeSimulation(&sim);
+
+STREAMING EVERY EVENT:
+StreamWriter stream;
+openStream(&stream, stdout, STREAM_NDJSON);
+sim.stream = &stream;
+runSimulation(&sim, -1);
+closeStream(&stream);
+
+COMPACTING ON A TIMER:
+Defragmenter defrag;
+enableDefragmenter(&mm, &defrag, 64, 10.0);   // 64 KB every 10 time units
+runSimulation(&sim, -1);                      // ticks follow the clock
+*/
+long runSimulation(Simulation *sim, double untilTime);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displaySimulationStats / freeSimulation
+--------------------------------------------------------------------------------
+EXAMPLE OUTPUT:
+Simulated time: 100012.40 | Events: 200000 (8.1 million/s)
+Allocated: 99120 | Admitted after waiting: 0 | Rejected: 880
+Average fragmentation: 12.45% | Now: 10.20%
+*/
+void displaySimulationStats(Simulation *sim);
+void freeSimulation(Simulation *sim);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: simulation.h
+================================================================================
+*/
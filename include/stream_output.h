@@ -0,0 +1,150 @@
+/*
+================================================================================
+FILE: stream_output.h
+PURPOSE: Machine-readable output - NDJSON or CSV records, heavily buffered
+DESCRIPTION:
+    - displayMemory() is written for people: an ASCII table, dozens of
+      small printf() calls per block
+    - Dashboards and the React UI want one record per event instead, in a
+      format they can parse line by line while the run is still going
+    - NDJSON = one complete JSON object per line; CSV = one row per line
+      with a fixed header
+    - Records are formatted by hand into one large buffer that is only
+      written out when it is full (one fwrite() per ~1 MB), so output
+      costs a small constant per event, even for 10 million events
+================================================================================
+*/
+
+#ifndef STREAM_OUTPUT_H
+#define STREAM_OUTPUT_H
+
+#include <stdio.h>
+#include "memory_manager.h"
+
+#define STREAM_BUFFER_SIZE (1 << 20)
+
+
+/*
+================================================================================
+RECORD TYPES
+================================================================================
+"event"  - One operation (alloc, free, arrive, depart, ...) and the totals
+           right after it: processes, holes, free KB, largest hole KB and
+           fragmentation %
+"state"  - The same totals plus the whole block list
+"error"  - A line that could not be run (script mode)
+"summary"- The end of a run (script mode)
+
+Events do NOT repeat the block list - that would make every event cost
+O(blocks). A reader that wants the layout takes the last "state" record.
+
+EXAMPLE (NDJSON):
+{"type":"event","seq":1,"time":null,"op":"alloc","pid":1,"size":100,"address":256,"algo":"first","ok":true,"processes":1,"holes":1,"free":668,"largest":668,"fragmentation":0.00}
+{"type":"state","seq":2,"time":null,"processes":1,"holes":1,"free":668,"largest":668,"fragmentation":0.00,"blocks":[[256,100,1],[356,668,-1]]}
+
+Each block is [start, size KB, pid]; pid -1 is a hole. Fields that do not
+apply to an event are null.
+
+EXAMPLE (CSV):
+type,seq,time,op,pid,size,address,algo,result,processes,holes,free,largest,fragmentation,message
+event,1,,alloc,1,100,256,first,ok,1,1,668,668,0.00,
+block,2,,,1,100,256,,,,,,,,
+block,2,,,-1,668,356,,,,,,,,
+state,2,,,,,,,,1,1,668,668,0.00,
+
+A state dump is one "block" row per block, then the "state" row.
+*/
+
+typedef enum {
+    STREAM_NDJSON,
+    STREAM_CSV
+} StreamFormat;
+
+
+/*
+================================================================================
+STRUCTURE: StreamWriter
+================================================================================
+PURPOSE: Output file, format and the buffer records are built in
+*/
+
+typedef struct StreamWriter {
+    FILE *out;
+    StreamFormat format;
+    char *buffer;           // STREAM_BUFFER_SIZE bytes
+    size_t used;            // Bytes waiting to be written
+    long records;           // Records written so far
+} StreamWriter;
+
+
+/*
+================================================================================
+STRUCTURE: StreamEvent
+================================================================================
+PURPOSE: What one event record says (besides the totals)
+*/
+
+typedef struct StreamEvent {
+    long sequence;          // Script line or simulation event number
+    double time;            // Simulated time, or -1 if there is none
+    const char *op;         // "alloc", "free", "arrive", "depart", ...
+    int processID;          // -1 if not about one process
+    int size;               // KB, -1 if not used
+    int address;            // Start address, -1 if none or failed
+    const char *algo;       // Fit used, or NULL
+    int ok;                 // 1 = succeeded, 0 = refused
+} StreamEvent;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: openStream / closeStream
+--------------------------------------------------------------------------------
+PURPOSE: Allocate the buffer (and write the CSV header) / write out what
+         is left and free the buffer
+
+openStream RETURNS: 1 on success, 0 if out of memory
+
+EXAMPLE:
+StreamWriter stream;
+openStream(&stream, stdout, STREAM_NDJSON);
+...
+closeStream(&stream);
+*/
+int openStream(StreamWriter *stream, FILE *out, StreamFormat format);
+void closeStream(StreamWriter *stream);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: flushStream
+--------------------------------------------------------------------------------
+PURPOSE: Write the buffer out now
+
+Only needed when a live reader must see records before the buffer fills;
+call it between records so the reader never gets half a line.
+*/
+void flushStream(StreamWriter *stream);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: streamEvent / streamState / streamNote
+--------------------------------------------------------------------------------
+streamEvent - One "event" record; O(1) when the largest hole is known
+              (hole tree or block index attached), else O(holes)
+streamState - One "state" record with every block; O(blocks)
+streamNote  - An "error" or "summary" record with a short message
+*/
+void streamEvent(StreamWriter *stream, MemoryManager *mm, const StreamEvent *event);
+void streamState(StreamWriter *stream, MemoryManager *mm, long sequence, double time);
+void streamNote(StreamWriter *stream, const char *type, long sequence, const char *message);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: stream_output.h
+================================================================================
+*/
@@ -0,0 +1,164 @@
+/*
+================================================================================
+FILE: swap.h
+PURPOSE: Swapping - move whole processes out to a backing store
+DESCRIPTION:
+    - When no hole is big enough, a resident process is "swapped out"
+      (copied to disk) and its memory becomes a hole
+    - Later it can be swapped back in, possibly at a different address
+    - Three ways to pick the victim (LRU, largest first, fewest bytes)
+    - Every KB moved counts as swap I/O, so policies can be compared
+================================================================================
+*/
+
+#ifndef SWAP_H
+#define SWAP_H
+
+#include "memory_manager.h"
+#include "block_index.h"
+
+
+/*
+================================================================================
+ENUMERATION: SwapPolicy
+================================================================================
+PURPOSE: Which resident process to swap out
+
+SWAP_LRU:           The one used longest ago
+SWAP_LARGEST_FIRST: The biggest one (frees the most per swap)
+SWAP_FEWEST_BYTES:  The smallest one that makes the request fit
+                    together with the holes beside it; if no single
+                    process is enough, the one that grows the largest
+                    hole the most, then try again
+
+EXAMPLE (need 100 KB):
+[HOLE:60][P1:30][P2:120][HOLE:10]
+- LARGEST_FIRST → P2 (120 KB written)
+- FEWEST_BYTES  → P1 (60 + 30 + 0 = 90 - not enough alone)
+                  P2 (0 + 120 + 10 = 130 - fits) → P2
+[HOLE:60][P1:50][HOLE:20]
+- FEWEST_BYTES  → P1 (60 + 50 + 20 = 130, only 50 KB written)
+*/
+
+typedef enum {
+    SWAP_LRU,
+    SWAP_LARGEST_FIRST,
+    SWAP_FEWEST_BYTES
+} SwapPolicy;
+
+
+/*
+================================================================================
+STRUCTURE: SwappedProcess / SwapSpace
+================================================================================
+PURPOSE: The backing store and its I/O counters
+
+HOW THE VICTIM IS FOUND:
+Without an index every choice would walk the whole block list. Swapping
+attaches a BlockIndex instead (block_index.h):
+- LRU: the front of its LRU list, O(1). touchProcess() moves a process
+  to the back, so call it whenever the process is used
+- LARGEST_FIRST: the right end of its size tree, O(log n)
+- FEWEST_BYTES: the size tree gives the smallest process that fits on
+  its own; smaller ones can only fit next to a big enough hole, so the
+  hole heap is walked from the top only as far as that can still help
+- A process's neighbours are block->prev / block->next, so the space a
+  swap-out would free is known in O(1)
+- The hole heap says in O(1) whether the request fits yet
+*/
+
+typedef struct SwappedProcess {
+    int processID;
+    int size;               // KB
+} SwappedProcess;
+
+typedef struct SwapSpace {
+    SwapPolicy policy;
+
+    SwappedProcess *swapped;    // Processes currently on the backing store
+    int numSwapped;
+    int capacity;
+
+    BlockIndex index;           // Used if mm had no index of its own
+    int ownsIndex;
+
+    // Statistics (swap I/O)
+    int swapOuts;
+    int swapIns;
+    long kbOut;
+    long kbIn;
+} SwapSpace;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableSwapping / disableSwapping
+--------------------------------------------------------------------------------
+PURPOSE: Attach a backing store to mm (caller owns 'swap')
+
+Attaches a BlockIndex too if mm does not have one yet. Processes still
+on the backing store when swapping is disabled are dropped.
+
+RETURNS: 1 on success, 0 if out of memory or the bitmap backend is in
+         use (victims are blocks)
+*/
+int enableSwapping(MemoryManager *mm, SwapSpace *swap, SwapPolicy policy);
+void disableSwapping(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: swapOutFor
+--------------------------------------------------------------------------------
+PURPOSE: Swap processes out until a hole of 'size' KB exists
+
+Called by allocateMemory() when no hole fits.
+
+RETURNS: Number of processes swapped out (0 if it could not help)
+*/
+int swapOutFor(MemoryManager *mm, int size);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: swapIn
+--------------------------------------------------------------------------------
+PURPOSE: Bring a swapped-out process back into memory
+
+May swap other processes out to make room.
+
+RETURNS: New start address, or -1 (then it stays on the backing store)
+*/
+int swapIn(MemoryManager *mm, int processID, AllocationAlgorithm algo);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: isSwapped / discardSwapped
+--------------------------------------------------------------------------------
+isSwapped      - 1 if 'processID' is on the backing store
+discardSwapped - The process finished while swapped out: forget it.
+                 Returns 1 if it was there (deallocateMemory uses this)
+*/
+int isSwapped(MemoryManager *mm, int processID);
+int discardSwapped(MemoryManager *mm, int processID);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displaySwapStats
+--------------------------------------------------------------------------------
+EXAMPLE OUTPUT:
+Swapping (fewest bytes): 2 processes on backing store
+Swap-outs: 5 (410 KB) | Swap-ins: 3 (260 KB)
+*/
+void displaySwapStats(MemoryManager *mm);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: swap.h
+================================================================================
+*/
@@ -0,0 +1,173 @@
+/*
+================================================================================
+FILE: tlb.h
+PURPOSE: Cost of address translation - TLB plus multi-level page walks
+DESCRIPTION:
+    - Every memory access needs logical → physical translation
+    - The TLB (Translation Lookaside Buffer) caches recent translations;
+      a hit is almost free
+    - A miss walks the page table: one memory read per level
+    - Bigger (huge) pages: each TLB entry covers more memory and the
+      walk is shorter, but more of each last page is wasted. This
+      model measures both sides on a PagingSystem (see paging.h)
+================================================================================
+*/
+
+#ifndef TLB_H
+#define TLB_H
+
+#include "paging.h"
+
+
+/*
+================================================================================
+STRUCTURE: TLBConfig
+================================================================================
+PURPOSE: Shape of the TLB for one page size
+
+Real CPUs have separate entries per page size (e.g. 64 for small pages,
+32 for huge pages). numSets * ways = number of entries.
+*/
+
+typedef struct TLBConfig {
+    int pageSize;           // KB
+    int numSets;
+    int ways;               // Entries per set (1 = direct mapped)
+} TLBConfig;
+
+
+/*
+================================================================================
+STRUCTURE: WalkCostModel
+================================================================================
+PURPOSE: How long a page walk takes
+
+LEVELS:
+The virtual space has 'addressBits' bits (counted in KB); the page
+offset takes log2(pageSize) of them and each level of the page table
+translates 'bitsPerLevel' more.
+
+EXAMPLE (addressBits 36, bitsPerLevel 9):
+  4 KB pages    → (36 - 2)  / 9 → 4 levels
+  2048 KB pages → (36 - 11) / 9 → 3 levels (one level skipped)
+*/
+
+typedef struct WalkCostModel {
+    int addressBits;
+    int bitsPerLevel;
+    int cyclesPerLevel;     // One memory read per level
+    int tlbHitCycles;
+} WalkCostModel;
+
+// 64 TB of virtual space, 512 entries per table, 4-level walk for 4 KB
+#define DEFAULT_WALK_COST {36, 9, 100, 1}
+
+
+/*
+================================================================================
+STRUCTURE: TLB / TranslationModel
+================================================================================
+TLB: numSets * ways slots, each holding (process, virtual page). A miss
+replaces the least recently used slot of its set.
+*/
+
+typedef struct TLB {
+    int pageSize;
+    int numSets;
+    int ways;
+    unsigned long long *keys;   // (processID, page) + 1; 0 = empty slot
+    unsigned int *lastUse;
+    unsigned int now;
+
+    long long hits;
+    long long misses;
+} TLB;
+
+typedef struct TranslationModel {
+    PagingSystem *paging;
+    TLB tlb;                    // The entries for paging->pageSize
+    WalkCostModel cost;
+    int walkLevels;
+
+    long long accesses;         // Valid translations
+    long long invalid;          // Address outside the process
+    long long walkCycles;       // Spent in page walks
+    long long totalCycles;      // Walks + TLB lookups
+} TranslationModel;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: pageWalkLevels
+--------------------------------------------------------------------------------
+PURPOSE: Number of page table levels for 'pageSize' (at least 1)
+*/
+int pageWalkLevels(const WalkCostModel *cost, int pageSize);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: initTranslationModel / freeTranslationModel
+--------------------------------------------------------------------------------
+PURPOSE: Put a TLB in front of 'ps'
+
+The config whose pageSize matches ps->pageSize is used (otherwise the
+largest one that is not bigger).
+
+RETURNS: 1 on success, 0 if no config fits or out of memory
+*/
+int initTranslationModel(TranslationModel *tm, PagingSystem *ps,
+                         const TLBConfig configs[], int numConfigs,
+                         WalkCostModel cost);
+void freeTranslationModel(TranslationModel *tm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: translateAccess
+--------------------------------------------------------------------------------
+PURPOSE: One memory access: TLB lookup, page walk on a miss
+
+RETURNS: Physical address, or -1 if the address is not in the process
+*/
+int translateAccess(TranslationModel *tm, int processID, int logicalAddress);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: displayTranslationStats
+--------------------------------------------------------------------------------
+EXAMPLE OUTPUT:
+16 KB pages, 4-level walk, TLB 16 sets x 4 ways
+TLB hit rate: 97.31% | Avg walk cost: 10.76 cycles/access | Avg total: 11.76
+*/
+void displayTranslationStats(TranslationModel *tm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: compareHugePages
+--------------------------------------------------------------------------------
+PURPOSE: Same workload under each page size, one report
+
+For every page size: page the processes ('sizes') into the user region
+of 'mm', replay 'numAccesses' random accesses with locality, and print
+internal fragmentation next to TLB hit rate and walk cost.
+
+EXAMPLE OUTPUT:
+Page    Frag     TLB hits   Walk/access   Cycles/access
+4 KB    0.94%    88.10%     47.60         48.60
+64 KB   7.81%    99.05%     2.85          3.85
+*/
+void compareHugePages(const MemoryManager *mm, const int sizes[], int n,
+                      const TLBConfig configs[], int numConfigs,
+                      WalkCostModel cost, long long numAccesses, unsigned int seed);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: tlb.h
+================================================================================
+*/
@@ -0,0 +1,127 @@
+/*
+================================================================================
+FILE: usage_map.h
+PURPOSE: Used KB per address range, for drawing memory at any zoom level
+DESCRIPTION:
+    - drawMemoryVisualization() prints one token per block - fine for ten
+      blocks, useless for a million, and not to scale
+    - This optional map splits user memory into equal buckets and keeps
+      "KB in use" for every bucket AND for every pair, quad, ... of
+      buckets (a sum tree), updated whenever a block changes owner
+    - "How much of [from, to) is used?" is then O(log buckets), so a bar
+      of N columns costs O(N log buckets) however many blocks exist
+    - Zoom and pan are just a different [from, to)
+================================================================================
+*/
+
+#ifndef USAGE_MAP_H
+#define USAGE_MAP_H
+
+#include "memory_manager.h"
+
+#define USAGE_MAP_MAX_BUCKETS 65536
+
+
+/*
+================================================================================
+STRUCTURE: UsageMap
+================================================================================
+PURPOSE: Sum tree of used KB over fixed-size address buckets
+
+EXAMPLE: 768 KB user memory, 4 buckets of 192 KB, P1 = 256-455 (200 KB)
+                    used[1] = 200              ← all of memory
+              /                  \
+       used[2] = 200          used[3] = 0      ← halves
+        /        \             /       \
+  used[4]=192 used[5]=8   used[6]=0  used[7]=0 ← buckets
+  256-447     448-639     640-831    832-1023
+
+Node i has children 2i and 2i+1; buckets are nodes numBuckets ..
+2*numBuckets-1. Each level is the same picture zoomed out by 2.
+*/
+
+typedef struct UsageMap {
+    int baseAddress;        // First address covered (end of OS)
+    int endAddress;         // First address past the covered range
+    int bucketSize;         // KB per bucket
+    int numBuckets;         // Power of 2
+    long *used;             // 2 * numBuckets sums, used[1] = root
+} UsageMap;
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: enableUsageMap / disableUsageMap
+--------------------------------------------------------------------------------
+PURPOSE: Build the map from the current blocks (caller owns 'map')
+
+maxBuckets caps the memory the map uses (at most USAGE_MAP_MAX_BUCKETS);
+buckets are made just large enough to cover user memory. Inside one
+bucket, usage is assumed to be spread evenly.
+
+RETURNS: 1 on success, 0 if out of memory
+*/
+int enableUsageMap(MemoryManager *mm, UsageMap *map, int maxBuckets);
+void disableUsageMap(MemoryManager *mm);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: usageMapUpdate
+--------------------------------------------------------------------------------
+PURPOSE: 'size' KB at 'start' became used (delta = +1) or free (-1)
+
+Called by bindBlock() / unbindBlock() and the bitmap and compact
+backends only;
+no-op without a map. Cost: O(buckets touched + log buckets).
+*/
+void usageMapUpdate(MemoryManager *mm, int start, int size, int delta);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: usedInRange
+--------------------------------------------------------------------------------
+PURPOSE: KB in use between 'from' and 'to' (to not included)
+
+Exact when both ends fall on bucket edges, otherwise the partial buckets
+are counted in proportion.
+*/
+long usedInRange(UsageMap *map, int from, int to);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: renderUsage
+--------------------------------------------------------------------------------
+PURPOSE: Split [from, to) into 'columns' equal slices; perMille[c] = how
+         full slice c is (0 = free ... 1000 = all used)
+
+This is what drawUsageBar() prints and what the React CityViewport
+reads through mav_usage() - O(columns * log buckets).
+
+RETURNS: Number of columns written (0 on a bad range)
+*/
+int renderUsage(UsageMap *map, int from, int to, int columns, int *perMille);
+
+
+/*
+--------------------------------------------------------------------------------
+FUNCTION: drawUsageBar
+--------------------------------------------------------------------------------
+PURPOSE: Print a to-scale bar of [from, to) with its end addresses
+
+EXAMPLE OUTPUT (columns = 32):
+256 [████████▓░░·····················███] 1023
+     █ used  ▓ mostly used  ░ mostly free  · free
+*/
+void drawUsageBar(UsageMap *map, int from, int to, int columns);
+
+
+#endif
+
+/*
+================================================================================
+END OF FILE: usage_map.h
+================================================================================
+*/
@@ -0,0 +1,324 @@
+/*
+================================================================================
+FILE: address_index.c
+PURPOSE: Implement address lookups over a treap of all blocks
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/address_index.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/compact_blocks.h"
+
+
+/*
+================================================================================
+TREAP (internal helpers)
+================================================================================
+Same shape as in hole_tree.c: every function returns the new root of
+the subtree it was given. No subtree maxima here - only the order.
+*/
+
+static MemoryBlock *insertNode(MemoryBlock *root, MemoryBlock *node) {
+    if (root == NULL) {
+        return node;
+    }
+
+    if (node->startAddress < root->startAddress) {
+        root->addrLeft = insertNode(root->addrLeft, node);
+        if (root->addrLeft->addrPriority > root->addrPriority) {
+            MemoryBlock *l = root->addrLeft;       // Rotate right
+            root->addrLeft = l->addrRight;
+            l->addrRight = root;
+            return l;
+        }
+    } else {
+        root->addrRight = insertNode(root->addrRight, node);
+        if (root->addrRight->addrPriority > root->addrPriority) {
+            MemoryBlock *r = root->addrRight;      // Rotate left
+            root->addrRight = r->addrLeft;
+            r->addrLeft = root;
+            return r;
+        }
+    }
+    return root;
+}
+
+// Join two treaps where every key in 'a' is below every key in 'b'
+static MemoryBlock *joinTrees(MemoryBlock *a, MemoryBlock *b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    if (a->addrPriority > b->addrPriority) {
+        a->addrRight = joinTrees(a->addrRight, b);
+        return a;
+    }
+    b->addrLeft = joinTrees(a, b->addrLeft);
+    return b;
+}
+
+static MemoryBlock *removeNode(MemoryBlock *root, MemoryBlock *node) {
+    if (root == node) {
+        return joinTrees(node->addrLeft, node->addrRight);
+    }
+    if (node->startAddress < root->startAddress) {
+        root->addrLeft = removeNode(root->addrLeft, node);
+    } else {
+        root->addrRight = removeNode(root->addrRight, node);
+    }
+    return root;
+}
+
+// xorshift - fast, and good enough for balancing
+static unsigned int nextPriority(AddressIndex *index) {
+    unsigned int x = index->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    index->seed = x;
+    return x;
+}
+
+
+/*
+================================================================================
+FUNCTION: enableAddressIndex / disableAddressIndex
+================================================================================
+*/
+
+int enableAddressIndex(MemoryManager *mm, AddressIndex *index) {
+    index->root = NULL;
+    index->numNodes = 0;
+    index->seed = 88172645u;
+
+    mm->addressIndex = index;
+    for (MemoryBlock *block = mm->head; block != NULL; block = block->next) {
+        addressIndexInsert(mm, block);
+    }
+    return 1;
+}
+
+void disableAddressIndex(MemoryManager *mm) {
+    if (mm->addressIndex == NULL) {
+        return;
+    }
+
+    for (MemoryBlock *block = mm->head; block != NULL; block = block->next) {
+        block->addrLeft = NULL;
+        block->addrRight = NULL;
+    }
+    mm->addressIndex->root = NULL;
+    mm->addressIndex->numNodes = 0;
+    mm->addressIndex = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: findBlockAt
+================================================================================
+PURPOSE: Highest start address <= 'address', then check it reaches that far
+
+EXAMPLE: blocks start at 256, 356, 556; address 400
+256 ≤ 400 → candidate, go right; 556 > 400 → go left; 356 ≤ 400 →
+candidate, go right; nothing there → answer 356 (356-555 holds 400)
+*/
+
+// No index: walk the list until the block that reaches 'address'
+static MemoryBlock *walkToAddress(MemoryManager *mm, int address) {
+    MemoryBlock *block = mm->head;
+    while (block != NULL && block->endAddress < address) {
+        block = block->next;
+    }
+    return block;
+}
+
+MemoryBlock *findBlockAt(MemoryManager *mm, int address) {
+    MemoryBlock *found = NULL;
+
+    if (address < mm->osMemory || address >= mm->totalMemory) {
+        return NULL;
+    }
+    if (mm->addressIndex == NULL) {
+        return walkToAddress(mm, address);
+    }
+
+    MemoryBlock *node = mm->addressIndex->root;
+    while (node != NULL) {
+        if (node->startAddress <= address) {
+            found = node;               // A candidate - try for a higher one
+            node = node->addrRight;
+        } else {
+            node = node->addrLeft;
+        }
+    }
+
+#ifdef MM_DEBUG_CHECKS
+    // The tree must agree with the list walk, block for block
+    if (found != walkToAddress(mm, address)) {
+        printf("Error: Address index found the wrong block for %d!\n", address);
+    }
+    addressIndexCheck(mm);
+#endif
+    return found;
+}
+
+
+/*
+================================================================================
+FUNCTION: beginBlockRange / nextInBlockRange
+================================================================================
+*/
+
+MemoryBlock *beginBlockRange(MemoryManager *mm, BlockRange *range, int from, int to) {
+    range->to = to;
+    range->current = NULL;
+
+    // The range may start in the OS region - begin at the first block then
+    if (from < mm->osMemory) {
+        from = mm->osMemory;
+    }
+    if (from < to) {
+        range->current = findBlockAt(mm, from);
+    }
+    return range->current;
+}
+
+MemoryBlock *nextInBlockRange(BlockRange *range) {
+    MemoryBlock *next = (range->current != NULL) ? range->current->next : NULL;
+
+    if (next != NULL && next->startAddress >= range->to) {
+        next = NULL;
+    }
+    range->current = next;
+    return next;
+}
+
+
+/*
+================================================================================
+FUNCTION: deallocateAt
+================================================================================
+*/
+
+int deallocateAt(MemoryManager *mm, int address) {
+    int processID = -1;
+
+    // STEP 1: Which process starts exactly here?
+    if (mm->bitmap != NULL) {
+        processID = bitmapProcessAt(mm, address);
+    } else if (mm->compactPool != NULL) {
+        processID = compactProcessAt(mm->compactPool, address);
+    } else {
+        MemoryBlock *block = findBlockAt(mm, address);
+        if (block != NULL && !block->isHole && block->startAddress == address) {
+            processID = block->processID;
+        }
+    }
+
+    if (processID == -1) {
+        return 0;
+    }
+
+    // STEP 2: Free it the normal way (merging, admission queue, viewer)
+    return deallocateMemory(mm, processID);
+}
+
+
+/*
+================================================================================
+UPDATES
+================================================================================
+*/
+
+void addressIndexInsert(MemoryManager *mm, MemoryBlock *block) {
+    AddressIndex *index = mm->addressIndex;
+    if (index == NULL) {
+        return;
+    }
+
+    block->addrLeft = NULL;
+    block->addrRight = NULL;
+    block->addrPriority = nextPriority(index);
+    index->root = insertNode(index->root, block);
+    index->numNodes++;
+}
+
+void addressIndexRemove(MemoryManager *mm, MemoryBlock *block) {
+    AddressIndex *index = mm->addressIndex;
+    if (index == NULL) {
+        return;
+    }
+
+    index->root = removeNode(index->root, block);
+    index->numNodes--;
+    block->addrLeft = NULL;
+    block->addrRight = NULL;
+}
+
+
+#ifdef MM_DEBUG_CHECKS
+/*
+================================================================================
+FUNCTION: addressIndexCheck (debug builds only)
+================================================================================
+*/
+
+// Returns the number of nodes below 'node', or -1 if something is wrong
+static int checkSubtree(MemoryBlock *node, int low, int high) {
+    if (node == NULL) {
+        return 0;
+    }
+    if (node->startAddress < low || node->startAddress >= high) {
+        return -1;
+    }
+
+    MemoryBlock *left = node->addrLeft;
+    MemoryBlock *right = node->addrRight;
+    if ((left != NULL && left->addrPriority > node->addrPriority) ||
+        (right != NULL && right->addrPriority > node->addrPriority)) {
+        return -1;
+    }
+
+    int leftCount = checkSubtree(left, low, node->startAddress);
+    int rightCount = checkSubtree(right, node->startAddress + 1, high);
+    if (leftCount < 0 || rightCount < 0) {
+        return -1;
+    }
+    return leftCount + rightCount + 1;
+}
+
+int addressIndexCheck(MemoryManager *mm) {
+    int count = checkSubtree(mm->addressIndex->root, 0, mm->totalMemory);
+    int blocks = 0;
+
+    for (MemoryBlock *block = mm->head; block != NULL; block = block->next) {
+        blocks++;
+    }
+    if (count != blocks || count != mm->addressIndex->numNodes) {
+        printf("Error: Address index is inconsistent!\n");
+        return 0;
+    }
+    return 1;
+}
+#endif
+
+
+/*
+================================================================================
+END OF FILE: address_index.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableAddressIndex() / disableAddressIndex() - Treap inside all blocks
+2. findBlockAt() - Block holding an address, O(log n) with the index
+3. beginBlockRange() / nextInBlockRange() - Blocks overlapping [from, to)
+4. deallocateAt() - Free by start address, like free(ptr)
+5. addressIndexInsert() / addressIndexRemove() - Upkeep on split / merge
+6. addressIndexCheck() - Full consistency check (MM_DEBUG_CHECKS only)
+================================================================================
+*/
@@ -0,0 +1,365 @@
+/*
+================================================================================
+FILE: admission_queue.c
+PURPOSE: Implement the pending-request queue with event-driven retry
+DESCRIPTION:
+    - pending[] is kept sorted in admission order for the active policy
+      (binary-search insert), so a retry is one walk from the front
+    - admitPendingRequests() is called after every free with the size of
+      the merged hole and only retries requests that fit in it
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/admission_queue.h"
+#include "../include/block_index.h"
+
+
+/*
+================================================================================
+HELPERS
+================================================================================
+*/
+
+// Does 'a' come before 'b' in admission order?
+static int comesBefore(AdmissionPolicy policy, const PendingRequest *a,
+                       const PendingRequest *b) {
+    if (policy == ADMIT_SMALLEST_FIRST && a->size != b->size) {
+        return a->size < b->size;
+    }
+    if (policy == ADMIT_PRIORITY && a->priority != b->priority) {
+        return a->priority > b->priority;
+    }
+    return a->sequence < b->sequence;
+}
+
+static void recomputeMinSize(AdmissionQueue *queue) {
+    queue->minSize = 0;
+    for (int i = 0; i < queue->numPending; i++) {
+        if (i == 0 || queue->pending[i].size < queue->minSize) {
+            queue->minSize = queue->pending[i].size;
+        }
+    }
+}
+
+// Advance the operation clock (unless a simulation drives the time)
+static void tick(AdmissionQueue *queue) {
+    if (!queue->externalClock) {
+        queue->now += 1.0;
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: enableAdmissionQueue / disableAdmissionQueue
+================================================================================
+*/
+
+void enableAdmissionQueue(MemoryManager *mm, AdmissionQueue *queue,
+                          AdmissionPolicy policy) {
+    memset(queue, 0, sizeof(AdmissionQueue));
+    queue->policy = policy;
+    mm->admissionQueue = queue;
+}
+
+void disableAdmissionQueue(MemoryManager *mm) {
+    AdmissionQueue *queue = mm->admissionQueue;
+
+    if (queue == NULL) {
+        return;
+    }
+
+    free(queue->pending);
+    free(queue->waitTimes);
+    queue->pending = NULL;
+    queue->waitTimes = NULL;
+    queue->numPending = 0;
+    mm->admissionQueue = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: submitRequest
+================================================================================
+*/
+
+int submitRequest(MemoryManager *mm, int processID, int size, int priority,
+                  AllocationAlgorithm algo) {
+    AdmissionQueue *queue = mm->admissionQueue;
+
+    // STEP 1: Without a queue this is a plain allocation
+    if (queue == NULL) {
+        return allocateMemory(mm, processID, size, algo);
+    }
+    tick(queue);
+
+    // STEP 2: Requests that can never fit are rejected, not queued
+    if (size <= 0 || size > mm->userMemory) {
+        printf("Error: Invalid process size!\n");
+        return -1;
+    }
+
+    // STEP 3: Try now (skip the attempt if free memory is clearly too low)
+    if (size <= mm->freeMemory) {
+        int address = allocateMemory(mm, processID, size, algo);
+        if (address != -1) {
+            return address;
+        }
+    }
+
+    // STEP 4: Wait - insert at the policy's position
+    if (queue->numPending == queue->capacity) {
+        int newCapacity = (queue->capacity == 0) ? 16 : queue->capacity * 2;
+        PendingRequest *bigger = (PendingRequest *)realloc(queue->pending,
+                                     sizeof(PendingRequest) * newCapacity);
+        if (bigger == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return -1;
+        }
+        queue->pending = bigger;
+        queue->capacity = newCapacity;
+    }
+
+    PendingRequest request;
+    request.processID = processID;
+    request.size = size;
+    request.priority = priority;
+    request.algo = algo;
+    request.sequence = queue->nextSequence++;
+    request.enqueuedAt = queue->now;
+
+    int low = 0;
+    int high = queue->numPending;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (comesBefore(queue->policy, &queue->pending[mid], &request)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    memmove(&queue->pending[low + 1], &queue->pending[low],
+            sizeof(PendingRequest) * (queue->numPending - low));
+    queue->pending[low] = request;
+    queue->numPending++;
+
+    if (queue->numPending == 1 || size < queue->minSize) {
+        queue->minSize = size;
+    }
+    return -1;
+}
+
+
+/*
+================================================================================
+FUNCTION: admitPendingRequests
+================================================================================
+*/
+
+// One walk over pending[] (admitPendingRequests() without the guard)
+static int admitPass(MemoryManager *mm, AdmissionQueue *queue, int holeSize) {
+    int admitted = 0;
+
+    // Several holes may have grown (batch free), or a deferred-coalescing
+    // sweep may have built a bigger hole than the one just freed: then
+    // look at the real largest hole instead (free with a BlockIndex)
+    int rescan = (holeSize < 0 || mm->quickLists != NULL || mm->blockIndex != NULL);
+    if (rescan) {
+        holeSize = largestHoleSize(mm);
+    }
+
+    // STEP 1: Nobody fits → done in O(1)
+    if (queue->minSize > holeSize) {
+        queue->skippedScans++;
+        return 0;
+    }
+
+    // STEP 2: Walk in admission order, retrying only requests that fit
+    int i = 0;
+    while (i < queue->numPending && holeSize >= queue->minSize) {
+        PendingRequest *request = &queue->pending[i];
+
+        if (request->size > holeSize) {
+            i++;
+            continue;
+        }
+
+        queue->retries++;
+        if (allocateMemory(mm, request->processID, request->size,
+                           request->algo) == -1) {
+            i++;
+            continue;
+        }
+
+        // STEP 3: Record how long it waited
+        if (queue->numAdmitted == queue->waitCapacity) {
+            int newCapacity = (queue->waitCapacity == 0) ? 64 : queue->waitCapacity * 2;
+            double *bigger = (double *)realloc(queue->waitTimes,
+                                               sizeof(double) * newCapacity);
+            if (bigger != NULL) {
+                queue->waitTimes = bigger;
+                queue->waitCapacity = newCapacity;
+            }
+        }
+        if (queue->numAdmitted < queue->waitCapacity) {
+            queue->waitTimes[queue->numAdmitted++] = queue->now - request->enqueuedAt;
+        }
+
+        // STEP 4: It took part of the hole; remove it from the queue
+        int admittedID = request->processID;
+        holeSize = rescan ? largestHoleSize(mm) : holeSize - request->size;
+        memmove(&queue->pending[i], &queue->pending[i + 1],
+                sizeof(PendingRequest) * (queue->numPending - i - 1));
+        queue->numPending--;
+        admitted++;
+
+        if (queue->onAdmit != NULL) {
+            queue->onAdmit(queue->onAdmitContext, admittedID);
+        }
+    }
+
+    if (admitted > 0) {
+        recomputeMinSize(queue);
+    }
+    return admitted;
+}
+
+int admitPendingRequests(MemoryManager *mm, int holeSize) {
+    AdmissionQueue *queue = mm->admissionQueue;
+    int admitted = 0;
+
+    if (queue == NULL) {
+        return 0;
+    }
+
+    // Called back from inside the walk (a defragmenter step in one of its
+    // allocateMemory() calls): pending[] is in use - just ask the walk
+    // to go round once more when it is done
+    if (queue->admitting) {
+        queue->admitAgain = 1;
+        return 0;
+    }
+    tick(queue);
+
+    queue->admitting = 1;
+    while (queue->numPending > 0) {
+        queue->admitAgain = 0;
+        admitted += admitPass(mm, queue, holeSize);
+        if (!queue->admitAgain) {
+            break;
+        }
+        holeSize = -1;      // Holes moved under the walk - look them up
+    }
+    queue->admitting = 0;
+    return admitted;
+}
+
+
+/*
+================================================================================
+FUNCTION: cancelPendingRequest
+================================================================================
+*/
+
+int cancelPendingRequest(MemoryManager *mm, int processID) {
+    AdmissionQueue *queue = mm->admissionQueue;
+
+    if (queue == NULL) {
+        return 0;
+    }
+
+    for (int i = 0; i < queue->numPending; i++) {
+        if (queue->pending[i].processID == processID) {
+            memmove(&queue->pending[i], &queue->pending[i + 1],
+                    sizeof(PendingRequest) * (queue->numPending - i - 1));
+            queue->numPending--;
+            recomputeMinSize(queue);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+================================================================================
+FUNCTION: setAdmissionTime
+================================================================================
+*/
+
+void setAdmissionTime(MemoryManager *mm, double now) {
+    if (mm->admissionQueue != NULL) {
+        mm->admissionQueue->now = now;
+        mm->admissionQueue->externalClock = 1;
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: displayAdmissionStats
+================================================================================
+*/
+
+static int compareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x < y) ? -1 : (x > y);
+}
+
+void displayAdmissionStats(MemoryManager *mm) {
+    AdmissionQueue *queue = mm->admissionQueue;
+    const char *policyNames[] = {"FIFO", "smallest-first", "priority"};
+
+    if (queue == NULL) {
+        printf("Admission queue: OFF\n");
+        return;
+    }
+
+    printf("Admission queue (%s): %d waiting, %d admitted after waiting\n",
+           policyNames[queue->policy], queue->numPending, queue->numAdmitted);
+    printf("Retries: %ld | Frees that skipped the queue: %ld\n",
+           queue->retries, queue->skippedScans);
+
+    if (queue->numAdmitted == 0) {
+        return;
+    }
+
+    // Sort a copy so percentiles can be read directly
+    int n = queue->numAdmitted;
+    double *sorted = (double *)malloc(sizeof(double) * n);
+    if (sorted == NULL) {
+        return;
+    }
+    memcpy(sorted, queue->waitTimes, sizeof(double) * n);
+    qsort(sorted, n, sizeof(double), compareDoubles);
+
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += sorted[i];
+    }
+
+    printf("Wait time: mean %.2f | p50 %.2f | p90 %.2f | p99 %.2f | max %.2f\n",
+           sum / n, sorted[(n - 1) / 2], sorted[(int)((n - 1) * 0.90)],
+           sorted[(int)((n - 1) * 0.99)], sorted[n - 1]);
+    free(sorted);
+}
+
+
+/*
+================================================================================
+END OF FILE: admission_queue.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableAdmissionQueue() / disableAdmissionQueue()
+2. submitRequest() - Allocate now or wait (policy-sorted insert)
+3. admitPendingRequests() - Retry only waiters that fit the freed hole
+4. cancelPendingRequest() / setAdmissionTime()
+5. displayAdmissionStats() - Wait-time percentiles
+================================================================================
+*/
@@ -0,0 +1,133 @@
+/*
+================================================================================
+FILE: aligned_alloc.c
+PURPOSE: Implement allocateAligned()
+DESCRIPTION:
+    One pass over memory picks the hole with the least leading waste,
+    then the hole is split twice: leading fragment | process | rest.
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/aligned_alloc.h"
+#include "../include/shared_view.h"
+#include "../include/quick_lists.h"
+#include "../include/bitmap_alloc.h"
+
+
+/*
+================================================================================
+FUNCTION: findAlignedHole (internal helper)
+================================================================================
+PURPOSE: Return the best hole for an aligned request, or NULL
+*/
+
+static MemoryBlock *findAlignedHole(MemoryManager *mm, int size, int align,
+                                    AllocationAlgorithm algo) {
+    MemoryBlock *chosen = NULL;
+    long chosenWaste = 0;
+    long chosenLeft = 0;
+
+    // Only holes can take it - follow the hole list
+    MemoryBlock *current = mm->firstHole;
+    while (current != NULL) {
+
+        // Round the start up to the next multiple of 'align'
+        long alignedStart = ((long)current->startAddress + align - 1) / align * align;
+        long waste = alignedStart - current->startAddress;
+        long left = current->size - waste - size;   // Space after process
+
+        if (left >= 0) {
+            int better;
+            if (chosen == NULL || waste < chosenWaste) {
+                better = 1;
+            } else if (waste > chosenWaste) {
+                better = 0;
+            } else if (algo == BEST_FIT) {
+                better = (left < chosenLeft);
+            } else if (algo == WORST_FIT) {
+                better = (left > chosenLeft);
+            } else {
+                better = 0;     // FIRST_FIT: keep the lower address
+            }
+
+            if (better) {
+                chosen = current;
+                chosenWaste = waste;
+                chosenLeft = left;
+
+                // Zero waste cannot be beaten - First Fit stops here
+                if (waste == 0 && algo == FIRST_FIT) {
+                    break;
+                }
+            }
+        }
+        current = current->nextHole;
+    }
+
+    return chosen;
+}
+
+
+/*
+================================================================================
+FUNCTION: allocateAligned
+================================================================================
+*/
+
+int allocateAligned(MemoryManager *mm, int processID, int size,
+                    int align, AllocationAlgorithm algo) {
+
+    // STEP 1: Validate input (same messages as allocateMemory)
+    if (!requireBlockList(mm, "Aligned allocation")) {
+        return -1;
+    }
+    if (size <= 0) {
+        printf("Error: Invalid process size!\n");
+        return -1;
+    }
+    if (align <= 0) {
+        printf("Error: Invalid alignment!\n");
+        return -1;
+    }
+    if (size > mm->freeMemory) {
+        printf("Error: Not enough free memory!\n");
+        printf("Requested: %d KB, Available: %d KB\n", size, mm->freeMemory);
+        return -1;
+    }
+
+    // STEP 2: Pick a hole (merge postponed holes and retry if none fits)
+    MemoryBlock *hole = findAlignedHole(mm, size, align, algo);
+    if (hole == NULL && sweepQuickLists(mm) > 0) {
+        hole = findAlignedHole(mm, size, align, algo);
+    }
+    if (hole == NULL) {
+        return -1;
+    }
+
+    // STEP 3: Cut off the leading fragment as its own hole
+    int alignedStart = (int)(((long)hole->startAddress + align - 1) / align * align);
+    if (alignedStart > hole->startAddress) {
+        hole = splitBlock(mm, hole, alignedStart);
+    }
+
+    // STEP 4: Place the process at the aligned start (splits the tail)
+    int address = placeProcess(mm, hole, processID, size);
+
+    // STEP 5: Let a live viewer see the change (no-op if none attached)
+    publishSharedView(mm, 0);
+    return address;
+}
+
+
+/*
+================================================================================
+END OF FILE: aligned_alloc.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. findAlignedHole() - Least leading waste, 'algo' breaks ties
+2. allocateAligned() - Split off the leading fragment, then place
+================================================================================
+*/
@@ -0,0 +1,513 @@
+/*
+================================================================================
+FILE: batch_alloc.c
+PURPOSE: Implement batched allocation and deallocation
+DESCRIPTION:
+    - allocateBatch() gives the same placements as n allocateMemory()
+      calls, but avoids restarting every search from the head
+    - allocateBatchRelaxed() places the largest requests first
+    - deallocateBatch() frees many processes in one pass over memory
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../include/batch_alloc.h"
+#include "../include/shared_view.h"
+#include "../include/admission_queue.h"
+#include "../include/segmentation.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/quick_lists.h"
+#include "../include/swap.h"
+#include "../include/defrag.h"
+
+
+/*
+================================================================================
+FIRST FIT: RESUMABLE CURSOR
+================================================================================
+After placing a process in hole H, every hole BEFORE H was too small for
+that request, and placing never changes those holes. So we remember:
+- cursor:    the first hole after the process we last placed (what is
+             left of H, or the hole after it when H was filled exactly)
+- prefixMax: the largest hole before the cursor
+A request bigger than prefixMax cannot fit before the cursor, so we can
+start searching at the cursor. Smaller requests restart from the first
+hole. Either way only the hole list is walked, never the processes.
+
+Filling a hole before the cursor (a quick-list hit) only makes
+prefixMax too high - that costs a restart, never a wrong placement.
+*/
+
+typedef struct FirstFitCursor {
+    MemoryBlock *cursor;
+    int prefixMax;
+} FirstFitCursor;
+
+static int batchFirstFit(MemoryManager *mm, FirstFitCursor *state,
+                         int processID, int size) {
+
+    // STEP 1: Choose where to start searching
+    MemoryBlock *hole = state->cursor;
+    int runningMax = state->prefixMax;
+    if (hole == NULL || size <= state->prefixMax) {
+        hole = mm->firstHole;
+        runningMax = 0;
+    }
+
+    // STEP 2: Same scan as firstFit(), tracking the largest hole passed
+    while (hole != NULL) {
+        if (hole->size >= size) {
+            MemoryBlock *following = hole->nextHole;
+            int hadLeftover = (hole->size > size);
+            int address = placeProcess(mm, hole, processID, size);
+
+            // The leftover is split off right after the process
+            state->cursor = hadLeftover ? hole->next : following;
+            state->prefixMax = runningMax;
+            return address;
+        }
+        if (hole->size > runningMax) {
+            runningMax = hole->size;
+        }
+        hole = hole->nextHole;
+    }
+
+    // No hole fits: memory did not change, so the cursor is still valid
+    return -1;
+}
+
+
+/*
+================================================================================
+BEST / WORST FIT: SORTED HOLE ARRAY
+================================================================================
+All holes are copied once into an array sorted by (size, address).
+- Best fit  = first entry with size >= request
+- Worst fit = first entry of the largest size
+Both tie-break on the lowest address, like bestFit()/worstFit().
+After each placement the used hole is removed and its leftover (if any)
+is inserted back at its sorted position.
+*/
+
+typedef struct HoleRef {
+    int size;
+    int startAddress;
+    MemoryBlock *block;
+} HoleRef;
+
+typedef struct HoleArray {
+    HoleRef *items;
+    int count;
+} HoleArray;
+
+static int compareHoleRefs(const void *a, const void *b) {
+    const HoleRef *x = (const HoleRef *)a;
+    const HoleRef *y = (const HoleRef *)b;
+    if (x->size != y->size) {
+        return (x->size < y->size) ? -1 : 1;
+    }
+    return (x->startAddress < y->startAddress) ? -1 :
+           (x->startAddress > y->startAddress) ? 1 : 0;
+}
+
+// Index of the first entry >= (size, startAddress)
+static int lowerBound(HoleArray *holes, int size, int startAddress) {
+    int low = 0;
+    int high = holes->count;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        HoleRef *h = &holes->items[mid];
+        if (h->size < size || (h->size == size && h->startAddress < startAddress)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static int buildHoleArray(MemoryManager *mm, HoleArray *holes) {
+    // numHoles + 1 so an empty memory still gets a valid allocation
+    holes->items = (HoleRef *)malloc(sizeof(HoleRef) * (mm->numHoles + 1));
+    holes->count = 0;
+    if (holes->items == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    MemoryBlock *current = mm->firstHole;
+    while (current != NULL) {
+        HoleRef *h = &holes->items[holes->count++];
+        h->size = current->size;
+        h->startAddress = current->startAddress;
+        h->block = current;
+        current = current->nextHole;
+    }
+
+    qsort(holes->items, holes->count, sizeof(HoleRef), compareHoleRefs);
+    return 1;
+}
+
+// Remove 'block' from the array (it is about to be filled)
+static void dropHoleRef(HoleArray *holes, MemoryBlock *block) {
+    int at = lowerBound(holes, block->size, block->startAddress);
+    if (at < holes->count && holes->items[at].block == block) {
+        memmove(&holes->items[at], &holes->items[at + 1],
+                sizeof(HoleRef) * (holes->count - at - 1));
+        holes->count--;
+    }
+}
+
+static int batchSortedFit(MemoryManager *mm, HoleArray *holes,
+                          AllocationAlgorithm algo, int processID, int size) {
+
+    // STEP 1: Pick the entry
+    int index;
+    if (algo == BEST_FIT) {
+        index = lowerBound(holes, size, INT_MIN);
+        if (index == holes->count) {
+            return -1;
+        }
+    } else {
+        if (holes->count == 0 || holes->items[holes->count - 1].size < size) {
+            return -1;
+        }
+        index = lowerBound(holes, holes->items[holes->count - 1].size, INT_MIN);
+    }
+
+    MemoryBlock *block = holes->items[index].block;
+    int hadLeftover = (block->size > size);
+
+    // STEP 2: Remove it from the array
+    memmove(&holes->items[index], &holes->items[index + 1],
+            sizeof(HoleRef) * (holes->count - index - 1));
+    holes->count--;
+
+    // STEP 3: Place the process (splits the hole if needed)
+    int address = placeProcess(mm, block, processID, size);
+
+    // STEP 4: The leftover hole is right after the process - insert it
+    if (hadLeftover) {
+        MemoryBlock *rest = block->next;
+        int at = lowerBound(holes, rest->size, rest->startAddress);
+        memmove(&holes->items[at + 1], &holes->items[at],
+                sizeof(HoleRef) * (holes->count - at));
+        holes->items[at].size = rest->size;
+        holes->items[at].startAddress = rest->startAddress;
+        holes->items[at].block = rest;
+        holes->count++;
+    }
+
+    return address;
+}
+
+
+/*
+================================================================================
+ONE BY ONE (bitmap / compact backend, swapping, incremental compaction)
+================================================================================
+The bitmap and compact backends have no block list to walk, so the batch
+simply becomes
+one allocateMemory() / deallocateMemory() call per request. Swapping
+and the defragmenter change memory in the middle of allocateMemory()
+(a compaction step before every search, swap-outs after a failed one),
+so with either of them on the batch does the same to stay identical.
+Messages stay off, like on the batched path.
+*/
+
+static int placeOneByOne(MemoryManager *mm, const int pids[], const int sizes[],
+                         const int order[], int n, AllocationAlgorithm algo,
+                         int outAddrs[]) {
+    int wasVerbose = isVerbose();
+    int placed = 0;
+
+    setVerbose(0);
+    for (int k = 0; k < n; k++) {
+        int i = (order != NULL) ? order[k] : k;
+        outAddrs[i] = allocateMemory(mm, pids[i], sizes[i], algo);
+        if (outAddrs[i] != -1) {
+            placed++;
+        }
+    }
+    setVerbose(wasVerbose);
+    return placed;
+}
+
+static int freeOneByOne(MemoryManager *mm, const int pids[], int n) {
+    int wasVerbose = isVerbose();
+    int freed = 0;
+
+    setVerbose(0);
+    for (int i = 0; i < n; i++) {
+        if (deallocateMemory(mm, pids[i])) {
+            freed++;
+        }
+    }
+    setVerbose(wasVerbose);
+    return freed;
+}
+
+
+// One request through the cursor (First Fit) or the sorted array
+static int batchFit(MemoryManager *mm, FirstFitCursor *cursor, HoleArray *holes,
+                    AllocationAlgorithm algo, int processID, int size) {
+    if (algo == FIRST_FIT) {
+        return batchFirstFit(mm, cursor, processID, size);
+    }
+    return batchSortedFit(mm, holes, algo, processID, size);
+}
+
+
+/*
+================================================================================
+FUNCTION: placeInOrder (internal helper)
+================================================================================
+PURPOSE: Place requests in the order given by 'order' (NULL = 0..n-1)
+*/
+
+static int placeInOrder(MemoryManager *mm, const int pids[], const int sizes[],
+                        const int order[], int n, AllocationAlgorithm algo,
+                        int outAddrs[]) {
+
+    FirstFitCursor cursor = {NULL, 0};
+    HoleArray holes = {NULL, 0};
+    int placed = 0;
+
+    if (algo != FIRST_FIT && algo != BEST_FIT && algo != WORST_FIT) {
+        for (int i = 0; i < n; i++) {
+            outAddrs[i] = -1;
+        }
+        return 0;
+    }
+
+    if (mm->bitmap != NULL || mm->compactPool != NULL || mm->swapSpace != NULL ||
+        mm->defragmenter != NULL) {
+        return placeOneByOne(mm, pids, sizes, order, n, algo, outAddrs);
+    }
+
+    if (algo != FIRST_FIT && !buildHoleArray(mm, &holes)) {
+        return 0;
+    }
+
+    for (int k = 0; k < n; k++) {
+        int i = (order != NULL) ? order[k] : k;
+
+        // Same validation as allocateMemory() (without the messages)
+        if (sizes[i] <= 0 || sizes[i] > mm->freeMemory) {
+            outAddrs[i] = -1;
+            continue;
+        }
+
+        // Deferred coalescing: a parked hole of exactly this size is
+        // reused first, as in allocateMemory(). Taking a hole never
+        // makes the First Fit cursor wrong (prefixMax only gets high)
+        MemoryBlock *cached = takeQuickBlock(mm, sizes[i]);
+        if (cached != NULL) {
+            if (algo != FIRST_FIT) {
+                dropHoleRef(&holes, cached);
+            } else if (cached == cursor.cursor) {
+                cursor.cursor = cached->nextHole;   // The cursor hole is being filled
+            }
+            outAddrs[i] = placeProcess(mm, cached, pids[i], sizes[i]);
+            placed++;
+            continue;
+        }
+
+        outAddrs[i] = batchFit(mm, &cursor, &holes, algo, pids[i], sizes[i]);
+
+        // Unmerged neighbours may add up to enough - merge them and retry.
+        // Holes before the cursor may have grown and array entries may
+        // have been merged away, so both start over
+        if (outAddrs[i] == -1 && sweepQuickLists(mm) > 0) {
+            cursor.cursor = NULL;
+            cursor.prefixMax = 0;
+            if (algo != FIRST_FIT) {
+                free(holes.items);
+                buildHoleArray(mm, &holes);     // Empty if out of memory
+            }
+            outAddrs[i] = batchFit(mm, &cursor, &holes, algo, pids[i], sizes[i]);
+        }
+
+        if (outAddrs[i] != -1) {
+            placed++;
+        }
+    }
+
+    free(holes.items);
+
+    // One mirror update for the whole batch
+    if (placed > 0) {
+        publishSharedView(mm, 0);
+    }
+    return placed;
+}
+
+
+/*
+================================================================================
+FUNCTION: allocateBatch
+================================================================================
+*/
+
+int allocateBatch(MemoryManager *mm, const int pids[], const int sizes[],
+                  int n, AllocationAlgorithm algo, int outAddrs[]) {
+    return placeInOrder(mm, pids, sizes, NULL, n, algo, outAddrs);
+}
+
+
+/*
+================================================================================
+FUNCTION: allocateBatchRelaxed
+================================================================================
+PURPOSE: Sort requests by size (largest first), then place
+
+Each (size, index) pair carries its own size, so the comparison needs
+no outside state and two batches can be sorted at the same time.
+*/
+
+typedef struct SizedRequest {
+    int size;
+    int index;
+} SizedRequest;
+
+static int compareBySizeDesc(const void *a, const void *b) {
+    const SizedRequest *x = (const SizedRequest *)a;
+    const SizedRequest *y = (const SizedRequest *)b;
+    if (x->size != y->size) {
+        return (x->size > y->size) ? -1 : 1;
+    }
+    return (x->index < y->index) ? -1 : (x->index > y->index);   // Keep request order
+}
+
+int allocateBatchRelaxed(MemoryManager *mm, const int pids[], const int sizes[],
+                         int n, AllocationAlgorithm algo, int outAddrs[]) {
+
+    SizedRequest *requests = (SizedRequest *)malloc(sizeof(SizedRequest) * (n > 0 ? n : 1));
+    int *order = (int *)malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (requests == NULL || order == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(requests);
+        free(order);
+        return 0;
+    }
+
+    for (int i = 0; i < n; i++) {
+        requests[i].size = sizes[i];
+        requests[i].index = i;
+    }
+    qsort(requests, n, sizeof(SizedRequest), compareBySizeDesc);
+    for (int k = 0; k < n; k++) {
+        order[k] = requests[k].index;
+    }
+    free(requests);
+
+    int placed = placeInOrder(mm, pids, sizes, order, n, algo, outAddrs);
+    free(order);
+    return placed;
+}
+
+
+/*
+================================================================================
+FUNCTION: deallocateBatch
+================================================================================
+PURPOSE: Free all listed processes in ONE walk over memory
+
+While walking we keep 'prev'. When a block becomes (or already is) a
+hole and 'prev' is a hole too, prev swallows it right away. A run of
+k neighbouring frees therefore collapses into one hole in a single pass.
+*/
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x < y) ? -1 : (x > y);
+}
+
+int deallocateBatch(MemoryManager *mm, const int pids[], int n) {
+
+    if (mm->bitmap != NULL || mm->compactPool != NULL) {
+        return freeOneByOne(mm, pids, n);
+    }
+
+    // STEP 1: Sorted copy of the PIDs so each lookup is a binary search
+    int *sorted = (int *)malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (sorted == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    memcpy(sorted, pids, sizeof(int) * n);
+    qsort(sorted, n, sizeof(int), compareInts);
+
+    int freed = 0;
+    MemoryBlock *prev = NULL;
+    MemoryBlock *current = mm->head;
+
+    // STEP 2: One pass - release listed processes, merge runs of holes
+    while (current != NULL) {
+
+        if (!current->isHole &&
+            bsearch(&current->processID, sorted, n, sizeof(int), compareInts) != NULL) {
+
+            // Count each process once, not each of its segments
+            if (current->segment <= 0) {
+                freed++;
+            }
+            unbindBlock(mm, current);
+        }
+
+        if (current->isHole && prev != NULL && prev->isHole) {
+            // prev swallows current (same as deallocateMemory's merge)
+            mergeWithNext(mm, prev);
+            current = prev->next;
+            continue;
+        }
+
+        prev = current;
+        current = current->next;
+    }
+
+    // Segment tables of freed processes point at holes now - drop them
+    if (mm->segments != NULL) {
+        for (int i = 0; i < n; i++) {
+            forgetSegmentTable(mm, sorted[i]);
+        }
+    }
+
+    // STEP 3: Listed processes that were not in memory may have finished
+    // while swapped out (deallocateMemory() does the same per PID)
+    int inMemory = freed;
+    if (mm->swapSpace != NULL) {
+        for (int i = 0; i < n; i++) {
+            freed += discardSwapped(mm, sorted[i]);
+        }
+    }
+
+    free(sorted);
+
+    // Waiting requests are retried once for the whole batch
+    // (-1: several holes grew, so admission looks for the largest),
+    // then one compaction step for the whole batch too
+    if (inMemory > 0) {
+        admitPendingRequests(mm, -1);
+        defragOnOperation(mm);
+        publishSharedView(mm, 0);
+    }
+    return freed;
+}
+
+
+/*
+================================================================================
+END OF FILE: batch_alloc.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. allocateBatch() - In-order batch, identical placements, fewer scans
+2. allocateBatchRelaxed() - Largest-first batch
+3. deallocateBatch() - One-pass free with run merging
+================================================================================
+*/
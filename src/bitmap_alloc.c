@@ -0,0 +1,676 @@
+/*
+================================================================================
+FILE: bitmap_alloc.c
+PURPOSE: Implement the bitmap backend (word-at-a-time run search)
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/bitmap_alloc.h"
+#include "../include/block_index.h"
+#include "../include/usage_map.h"
+
+#define BITS_PER_WORD 64
+#define FULL_WORD (~0ULL)
+
+
+/*
+================================================================================
+BIT HELPERS (internal)
+================================================================================
+*/
+
+static int unitIsFree(BitmapBackend *bb, int unit) {
+    return ((bb->bits[unit / BITS_PER_WORD] >> (unit % BITS_PER_WORD)) & 1ULL) == 0;
+}
+
+// Bits lo .. hi-1 of one word (0 <= lo < hi <= 64)
+static unsigned long long rangeMask(int lo, int hi) {
+    unsigned long long width = (hi - lo == BITS_PER_WORD) ? FULL_WORD : ((1ULL << (hi - lo)) - 1);
+    return width << lo;
+}
+
+static void updateSummary(BitmapBackend *bb, int w) {
+    unsigned long long bit = 1ULL << (w % BITS_PER_WORD);
+    if (bb->bits[w] == FULL_WORD) {
+        bb->fullWords[w / BITS_PER_WORD] |= bit;
+    } else {
+        bb->fullWords[w / BITS_PER_WORD] &= ~bit;
+    }
+}
+
+// Mark units first .. first+count-1 as used (1) or free (0)
+static void setRange(BitmapBackend *bb, int first, int count, int used) {
+    int unit = first;
+    int end = first + count;
+
+    while (unit < end) {
+        int w = unit / BITS_PER_WORD;
+        int lo = unit % BITS_PER_WORD;
+        int hi = (end - w * BITS_PER_WORD < BITS_PER_WORD) ? end - w * BITS_PER_WORD : BITS_PER_WORD;
+        unsigned long long mask = rangeMask(lo, hi);
+
+        if (used) {
+            bb->bits[w] |= mask;
+        } else {
+            bb->bits[w] &= ~mask;
+        }
+        updateSummary(bb, w);
+        unit = w * BITS_PER_WORD + hi;
+    }
+}
+
+
+/*
+================================================================================
+PROCESS TABLE (internal helpers)
+================================================================================
+Open addressing: a PID lives at hash(pid) or the first free slot after.
+*/
+
+static int slotOf(BitmapBackend *bb, int processID) {
+    return (int)(((unsigned int)processID * 2654435761u) & (unsigned int)(bb->tableCapacity - 1));
+}
+
+static int tableFind(BitmapBackend *bb, int processID) {
+    int slot = slotOf(bb, processID);
+    while (bb->table[slot].processID != -1) {
+        if (bb->table[slot].processID == processID) {
+            return slot;
+        }
+        slot = (slot + 1) & (bb->tableCapacity - 1);
+    }
+    return -1;
+}
+
+static void tablePut(BitmapBackend *bb, BitmapEntry entry) {
+    int slot = slotOf(bb, entry.processID);
+    while (bb->table[slot].processID != -1) {
+        slot = (slot + 1) & (bb->tableCapacity - 1);
+    }
+    bb->table[slot] = entry;
+    bb->tableCount++;
+}
+
+// Keep the table at most half full (short probe runs)
+static int tableGrow(BitmapBackend *bb) {
+    BitmapEntry *old = bb->table;
+    int oldCapacity = bb->tableCapacity;
+    BitmapEntry *bigger = (BitmapEntry *)malloc(sizeof(BitmapEntry) * oldCapacity * 2);
+
+    if (bigger == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < oldCapacity * 2; i++) {
+        bigger[i].processID = -1;
+    }
+
+    bb->table = bigger;
+    bb->tableCapacity = oldCapacity * 2;
+    bb->tableCount = 0;
+    for (int i = 0; i < oldCapacity; i++) {
+        if (old[i].processID != -1) {
+            tablePut(bb, old[i]);
+        }
+    }
+    free(old);
+    return 1;
+}
+
+// Remove a slot and pull later entries of the probe run back into the gap
+static void tableRemove(BitmapBackend *bb, int slot) {
+    int mask = bb->tableCapacity - 1;
+    int gap = slot;
+    int next = (slot + 1) & mask;
+
+    while (bb->table[next].processID != -1) {
+        int home = slotOf(bb, bb->table[next].processID);
+        // Move it if its home is not between the gap and its slot
+        if (((next - home) & mask) >= ((next - gap) & mask)) {
+            bb->table[gap] = bb->table[next];
+            gap = next;
+        }
+        next = (next + 1) & mask;
+    }
+    bb->table[gap].processID = -1;
+    bb->tableCount--;
+}
+
+
+/*
+================================================================================
+FUNCTION: findRun (internal helper)
+================================================================================
+PURPOSE: First unit of the run the algorithm picks, or -1
+
+Walks the free runs in address order. Inside a word, the next free bit
+and the next used bit are both one count-trailing-zeros away, so a word
+costs O(runs in it), not O(64). A full summary word skips 4096 units.
+
+Rules (same as the block list):
+- FIRST_FIT: first run that is long enough
+- BEST_FIT:  shortest run that is long enough (first of equals)
+- WORST_FIT: longest run that is long enough (first of equals)
+*/
+
+// Offer one finished run; returns 1 when the search can stop
+static int considerRun(long runStart, long length, int units, AllocationAlgorithm algo,
+                       long *chosen, long *chosenLength) {
+    if (length < units) {
+        return 0;
+    }
+    if (*chosen == -1 ||
+        (algo == BEST_FIT && length < *chosenLength) ||
+        (algo == WORST_FIT && length > *chosenLength)) {
+        *chosen = runStart;
+        *chosenLength = length;
+    }
+    // First Fit takes the first; an exact fit can't be beaten by Best Fit
+    return algo == FIRST_FIT || (algo == BEST_FIT && length == units);
+}
+
+static int findRun(BitmapBackend *bb, int units, AllocationAlgorithm algo) {
+    long runStart = -1;         // Start of the free run we are inside
+    long chosen = -1;
+    long chosenLength = 0;
+
+    for (int s = 0; s < bb->numSummaryWords; s++) {
+        int lastWord = (s + 1) * BITS_PER_WORD;
+        if (lastWord > bb->numWords) {
+            lastWord = bb->numWords;
+        }
+
+        // 64 full words in a row - nothing free here at all
+        if (bb->fullWords[s] == FULL_WORD) {
+            if (runStart != -1) {
+                long end = (long)s * BITS_PER_WORD * BITS_PER_WORD;
+                if (considerRun(runStart, end - runStart, units, algo, &chosen, &chosenLength)) {
+                    return (int)chosen;
+                }
+                runStart = -1;
+            }
+            continue;
+        }
+
+        for (int w = s * BITS_PER_WORD; w < lastWord; w++) {
+            unsigned long long word = bb->bits[w];
+            long wordStart = (long)w * BITS_PER_WORD;
+            int p = 0;
+            bb->wordsScanned++;
+
+            while (p < BITS_PER_WORD) {
+                unsigned long long above = FULL_WORD << p;
+
+                if (runStart == -1) {
+                    // Looking for the next free bit
+                    unsigned long long freeBits = ~word & above;
+                    if (freeBits == 0) {
+                        break;
+                    }
+                    p = __builtin_ctzll(freeBits);
+                    runStart = wordStart + p;
+                    continue;
+                }
+
+                // Inside a run - looking for the next used bit
+                unsigned long long usedBits = word & above;
+                if (usedBits == 0) {
+                    // Run goes on into the next word (First Fit may
+                    // already know it is long enough)
+                    if (algo == FIRST_FIT && wordStart + BITS_PER_WORD - runStart >= units) {
+                        return (int)runStart;
+                    }
+                    break;
+                }
+
+                p = __builtin_ctzll(usedBits);
+                if (considerRun(runStart, wordStart + p - runStart, units, algo,
+                                &chosen, &chosenLength)) {
+                    return (int)chosen;
+                }
+                runStart = -1;
+            }
+        }
+    }
+
+    // A run that reaches the very end (only when numUnits fills every word)
+    if (runStart != -1) {
+        considerRun(runStart, (long)bb->numUnits - runStart, units, algo, &chosen, &chosenLength);
+    }
+    return (int)chosen;
+}
+
+
+/*
+================================================================================
+FUNCTION: enableBitmapBackend / disableBitmapBackend
+================================================================================
+*/
+
+int enableBitmapBackend(MemoryManager *mm, BitmapBackend *bb, int unitSize) {
+
+    // STEP 1: Validate
+    if (mm->numProcesses > 0) {
+        printf("Error: The bitmap backend needs empty memory!\n");
+        return 0;
+    }
+    if (mm->segments != NULL) {
+        printf("Error: Segment tables point at blocks - disable segmentation first!\n");
+        return 0;
+    }
+    if (mm->compactPool != NULL) {
+        printf("Error: Memory is already a compact pool - use one backend only!\n");
+        return 0;
+    }
+    if (unitSize <= 0 || unitSize > mm->userMemory) {
+        printf("Error: Invalid unit size!\n");
+        return 0;
+    }
+
+    // STEP 2: One bit per unit, one summary bit per word
+    bb->unitSize = unitSize;
+    bb->baseAddress = mm->osMemory;
+    bb->numUnits = mm->userMemory / unitSize;
+    bb->freeUnits = bb->numUnits;
+    bb->numWords = (bb->numUnits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    bb->numSummaryWords = (bb->numWords + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    bb->bits = (unsigned long long *)calloc(bb->numWords, sizeof(unsigned long long));
+    bb->fullWords = (unsigned long long *)calloc(bb->numSummaryWords, sizeof(unsigned long long));
+    bb->tableCapacity = 64;
+    bb->tableCount = 0;
+    bb->table = (BitmapEntry *)malloc(sizeof(BitmapEntry) * bb->tableCapacity);
+    bb->wordsScanned = 0;
+
+    if (bb->bits == NULL || bb->fullWords == NULL || bb->table == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(bb->bits);
+        free(bb->fullWords);
+        free(bb->table);
+        return 0;
+    }
+    for (int i = 0; i < bb->tableCapacity; i++) {
+        bb->table[i].processID = -1;
+    }
+
+    // STEP 3: Units past the end and summary bits past the last word
+    // count as used, so no search can ever hand them out
+    int tailUnits = bb->numUnits % BITS_PER_WORD;
+    if (tailUnits != 0) {
+        bb->bits[bb->numWords - 1] = FULL_WORD << tailUnits;
+    }
+    int tailWords = bb->numWords % BITS_PER_WORD;
+    if (tailWords != 0) {
+        bb->fullWords[bb->numSummaryWords - 1] = FULL_WORD << tailWords;
+    }
+
+    // STEP 4: Memory now counts in whole units
+    mm->freeMemory = bb->numUnits * unitSize;
+    mm->numHoles = 1;
+    mm->bitmap = bb;
+    return 1;
+}
+
+void disableBitmapBackend(MemoryManager *mm) {
+    BitmapBackend *bb = mm->bitmap;
+
+    if (bb == NULL) {
+        return;
+    }
+    free(bb->bits);
+    free(bb->fullWords);
+    free(bb->table);
+    bb->bits = NULL;
+    bb->fullWords = NULL;
+    bb->table = NULL;
+    mm->bitmap = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: requireBlockList
+================================================================================
+*/
+
+int requireBlockList(MemoryManager *mm, const char *operation) {
+    if (mm->bitmap == NULL && mm->compactPool == NULL) {
+        return 1;
+    }
+    if (isVerbose()) {
+        printf("Error: %s needs the block list, not the %s backend!\n", operation,
+               (mm->bitmap != NULL) ? "bitmap" : "compact");
+    }
+    return 0;
+}
+
+
+/*
+================================================================================
+FUNCTION: bitmapAllocate
+================================================================================
+*/
+
+int bitmapAllocate(MemoryManager *mm, int processID, int size, AllocationAlgorithm algo) {
+    BitmapBackend *bb = mm->bitmap;
+
+    // STEP 1: Whole units only (1 KB units = exact)
+    int units = (size + bb->unitSize - 1) / bb->unitSize;
+    if (units > bb->freeUnits) {
+        return -1;
+    }
+    if (tableFind(bb, processID) != -1) {
+        printf("Error: P%d is already in memory!\n", processID);
+        return -1;
+    }
+    if ((bb->tableCount + 1) * 2 > bb->tableCapacity && !tableGrow(bb)) {
+        printf("Error: Memory allocation failed!\n");
+        return -1;
+    }
+
+    // STEP 2: Find a run of free units
+    int first = findRun(bb, units, algo);
+    if (first == -1) {
+        return -1;
+    }
+
+    // STEP 3: Take it (always from the start of the run, like a split)
+    setRange(bb, first, units, 1);
+    bb->freeUnits -= units;
+    BitmapEntry entry = {processID, first, units};
+    tablePut(bb, entry);
+
+    // The run is gone unless free units are left after it
+    int end = first + units;
+    if (end >= bb->numUnits || !unitIsFree(bb, end)) {
+        mm->numHoles--;
+    }
+    mm->numProcesses++;
+    mm->freeMemory -= units * bb->unitSize;
+    usageMapUpdate(mm, bb->baseAddress + first * bb->unitSize, units * bb->unitSize, 1);
+    return bb->baseAddress + first * bb->unitSize;
+}
+
+
+/*
+================================================================================
+FUNCTION: bitmapFree
+================================================================================
+*/
+
+int bitmapFree(MemoryManager *mm, int processID) {
+    BitmapBackend *bb = mm->bitmap;
+    int slot = tableFind(bb, processID);
+
+    if (slot == -1) {
+        return 0;
+    }
+
+    BitmapEntry entry = bb->table[slot];
+    tableRemove(bb, slot);
+
+    // Merging is free: clearing the bits joins the neighbouring runs.
+    // Holes: +1 for this run, -1 for each free neighbour it joins
+    int end = entry.firstUnit + entry.numUnits;
+    int freeBefore = (entry.firstUnit > 0 && unitIsFree(bb, entry.firstUnit - 1));
+    int freeAfter = (end < bb->numUnits && unitIsFree(bb, end));
+    setRange(bb, entry.firstUnit, entry.numUnits, 0);
+
+    bb->freeUnits += entry.numUnits;
+    mm->numHoles += 1 - freeBefore - freeAfter;
+    mm->numProcesses--;
+    mm->freeMemory += entry.numUnits * bb->unitSize;
+    usageMapUpdate(mm, bb->baseAddress + entry.firstUnit * bb->unitSize,
+                   entry.numUnits * bb->unitSize, -1);
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: bitmapLargestRun / bitmapMetadataBytes / bitmapProcessAt
+================================================================================
+*/
+
+int bitmapLargestRun(MemoryManager *mm) {
+    BitmapBackend *bb = mm->bitmap;
+    long scanned = bb->wordsScanned;      // Not a search - don't count it
+
+    // Worst Fit for one unit finds the longest run; measure it
+    int first = findRun(bb, 1, WORST_FIT);
+    bb->wordsScanned = scanned;
+    if (first == -1) {
+        return 0;
+    }
+
+    int unit = first;
+    while (unit < bb->numUnits && unitIsFree(bb, unit)) {
+        unit++;
+    }
+    return (unit - first) * bb->unitSize;
+}
+
+long bitmapMetadataBytes(BitmapBackend *bb) {
+    return (long)bb->numWords * sizeof(unsigned long long)
+         + (long)bb->numSummaryWords * sizeof(unsigned long long)
+         + (long)bb->tableCapacity * sizeof(BitmapEntry);
+}
+
+
+int bitmapProcessAt(MemoryManager *mm, int address) {
+    BitmapBackend *bb = mm->bitmap;
+    int offset = address - bb->baseAddress;
+
+    if (offset < 0 || offset % bb->unitSize != 0) {
+        return -1;
+    }
+    for (int i = 0; i < bb->tableCapacity; i++) {
+        if (bb->table[i].processID != -1 && bb->table[i].firstUnit == offset / bb->unitSize) {
+            return bb->table[i].processID;
+        }
+    }
+    return -1;
+}
+
+
+/*
+================================================================================
+FUNCTION: listBitmapProcesses / displayBitmap
+================================================================================
+*/
+
+static int compareByUnit(const void *a, const void *b) {
+    return ((const BitmapEntry *)a)->firstUnit - ((const BitmapEntry *)b)->firstUnit;
+}
+
+int listBitmapProcesses(MemoryManager *mm) {
+    BitmapBackend *bb = mm->bitmap;
+    BitmapEntry *sorted = (BitmapEntry *)malloc(sizeof(BitmapEntry) * (bb->tableCount + 1));
+    int count = 0;
+
+    if (sorted == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    // The table is in hash order - sort a copy by address
+    for (int i = 0; i < bb->tableCapacity; i++) {
+        if (bb->table[i].processID != -1) {
+            sorted[count++] = bb->table[i];
+        }
+    }
+    qsort(sorted, count, sizeof(BitmapEntry), compareByUnit);
+
+    for (int i = 0; i < count; i++) {
+        printf("  P%d (%d KB at address %d)\n", sorted[i].processID,
+               sorted[i].numUnits * bb->unitSize,
+               bb->baseAddress + sorted[i].firstUnit * bb->unitSize);
+    }
+    free(sorted);
+    return count;
+}
+
+void displayBitmap(MemoryManager *mm) {
+    BitmapBackend *bb = mm->bitmap;
+    int columns = 64;
+    int perColumn = (bb->numUnits + columns - 1) / columns;
+
+    // STEP 1: One character per group of units: # full, . free, + mixed
+    printf("\nUnits (%d KB each, %d per character):\n[", bb->unitSize, perColumn);
+    for (int c = 0; c * perColumn < bb->numUnits; c++) {
+        int used = 0;
+        int total = 0;
+        for (int u = c * perColumn; u < (c + 1) * perColumn && u < bb->numUnits; u++) {
+            used += !unitIsFree(bb, u);
+            total++;
+        }
+        printf("%c", used == 0 ? '.' : (used == total ? '#' : '+'));
+    }
+    printf("]\n");
+    listBitmapProcesses(mm);
+
+    // STEP 2: Totals
+    printf("Processes: %d | Free: %d KB in %d holes | Largest hole: %d KB\n",
+           mm->numProcesses, mm->freeMemory, mm->numHoles, bitmapLargestRun(mm));
+    printf("Metadata: %ld bytes (%d bitmap words, %d summary words, %d table slots)\n",
+           bitmapMetadataBytes(bb), bb->numWords, bb->numSummaryWords, bb->tableCapacity);
+}
+
+
+/*
+================================================================================
+FUNCTION: compareBackends
+================================================================================
+*/
+
+typedef struct BackendRun {
+    int placed;
+    double milliseconds;
+    long metadataBytes;
+} BackendRun;
+
+// One workload on one manager; addresses[op] gets each result (-2 = free)
+static BackendRun runWorkload(MemoryManager *mm, AllocationAlgorithm algo,
+                              int numOps, unsigned int seed, int *addresses) {
+    BackendRun run = {0, 0.0, 0};
+    int *live = (int *)malloc(sizeof(int) * (numOps + 1));
+    int numLive = 0;
+    int nextPID = 1;
+    unsigned int state = seed;
+
+    if (live == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return run;
+    }
+
+    clock_t start = clock();
+    for (int op = 0; op < numOps; op++) {
+        state = state * 1103515245u + 12345u;
+        unsigned int r = state >> 8;
+
+        if (numLive > 0 && r % 3 == 0) {
+            // Free a random live process
+            int i = (int)((r / 3) % (unsigned int)numLive);
+            deallocateMemory(mm, live[i]);
+            live[i] = live[--numLive];
+            addresses[op] = -2;
+        } else {
+            // 1 - 64 KB; only when the total fits (no error messages)
+            int size = 1 + (int)((r / 3) % 64);
+            int address = -1;
+            if (size <= mm->freeMemory) {
+                address = allocateMemory(mm, nextPID, size, algo);
+            }
+            if (address != -1) {
+                live[numLive++] = nextPID;
+                run.placed++;
+            }
+            addresses[op] = address;
+            nextPID++;
+        }
+    }
+    run.milliseconds = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    if (mm->bitmap != NULL) {
+        run.metadataBytes = bitmapMetadataBytes(mm->bitmap);
+    } else {
+        run.metadataBytes = (long)(mm->numProcesses + mm->numHoles) * sizeof(MemoryBlock);
+    }
+    free(live);
+    return run;
+}
+
+void compareBackends(int userMemory, int numOps, unsigned int seed) {
+    const char *names[] = {"First Fit", "Best Fit", "Worst Fit"};
+    BackendRun results[3][2];
+    int same[3];
+    int *listAddresses = (int *)malloc(sizeof(int) * numOps);
+    int *bitmapAddresses = (int *)malloc(sizeof(int) * numOps);
+
+    if (listAddresses == NULL || bitmapAddresses == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(listAddresses);
+        free(bitmapAddresses);
+        return;
+    }
+
+    // STEP 1: Same requests on both backends, for each algorithm
+    for (int algo = FIRST_FIT; algo <= WORST_FIT; algo++) {
+        MemoryManager listMM;
+        MemoryManager bitmapMM;
+        BlockIndex index;           // So frees find their block in O(1) too
+        BitmapBackend bitmap;
+
+        initializeMemory(&listMM, 256 + userMemory, 256);
+        enableBlockIndex(&listMM, &index);
+        results[algo][0] = runWorkload(&listMM, (AllocationAlgorithm)algo, numOps, seed, listAddresses);
+
+        initializeMemory(&bitmapMM, 256 + userMemory, 256);
+        enableBitmapBackend(&bitmapMM, &bitmap, 1);
+        results[algo][1] = runWorkload(&bitmapMM, (AllocationAlgorithm)algo, numOps, seed, bitmapAddresses);
+
+        same[algo] = 1;
+        for (int op = 0; op < numOps; op++) {
+            if (listAddresses[op] != bitmapAddresses[op]) {
+                same[algo] = 0;
+                break;
+            }
+        }
+        freeMemoryManager(&listMM);
+        freeMemoryManager(&bitmapMM);
+    }
+
+    // STEP 2: One table
+    printf("\n%d random steps over %d KB:\n", numOps, userMemory);
+    printf("Algorithm  Backend  Placed  Time (ms)  Metadata    Same\n");
+    for (int algo = FIRST_FIT; algo <= WORST_FIT; algo++) {
+        for (int b = 0; b < 2; b++) {
+            char bytes[24];
+            snprintf(bytes, sizeof(bytes), "%ld B", results[algo][b].metadataBytes);
+            printf("%-10s %-8s %-7d %-10.2f %-11s %s\n", names[algo], b ? "Bitmap" : "List",
+                   results[algo][b].placed, results[algo][b].milliseconds, bytes,
+                   b ? (same[algo] ? "yes" : "no") : "");
+        }
+    }
+
+    free(listAddresses);
+    free(bitmapAddresses);
+}
+
+
+/*
+================================================================================
+END OF FILE: bitmap_alloc.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableBitmapBackend() / disableBitmapBackend() - Bitmap + summary + table
+   requireBlockList() - Guard for the block-list-only operations
+2. findRun() - First / best / worst run with ctz, full regions skipped
+3. bitmapAllocate() / bitmapFree() - Set / clear bits, hole count upkeep
+4. bitmapLargestRun() / bitmapMetadataBytes() / bitmapProcessAt() - Lookups
+5. listBitmapProcesses() / displayBitmap() - Process list and unit map
+6. compareBackends() - Same workload on list and bitmap, side by side
+================================================================================
+*/
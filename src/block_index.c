@@ -0,0 +1,534 @@
+/*
+================================================================================
+FILE: block_index.c
+PURPOSE: Implement the hole max-heap and the PID hash table
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/block_index.h"
+#include "../include/hole_tree.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/compact_blocks.h"
+
+
+/*
+================================================================================
+HOLE HEAP (internal helpers)
+================================================================================
+Children of position i are 2i+1 and 2i+2; a parent is never smaller
+than its children.
+*/
+
+static void heapPlace(BlockIndex *index, int position, MemoryBlock *hole) {
+    index->holeHeap[position] = hole;
+    hole->holeHeapIndex = position;
+}
+
+static void siftUp(BlockIndex *index, int position) {
+    MemoryBlock *hole = index->holeHeap[position];
+    while (position > 0) {
+        int parent = (position - 1) / 2;
+        if (index->holeHeap[parent]->size >= hole->size) {
+            break;
+        }
+        heapPlace(index, position, index->holeHeap[parent]);
+        position = parent;
+    }
+    heapPlace(index, position, hole);
+}
+
+static void siftDown(BlockIndex *index, int position) {
+    MemoryBlock *hole = index->holeHeap[position];
+    while (1) {
+        int child = 2 * position + 1;
+        if (child >= index->heapSize) {
+            break;
+        }
+        if (child + 1 < index->heapSize &&
+            index->holeHeap[child + 1]->size > index->holeHeap[child]->size) {
+            child++;
+        }
+        if (index->holeHeap[child]->size <= hole->size) {
+            break;
+        }
+        heapPlace(index, position, index->holeHeap[child]);
+        position = child;
+    }
+    heapPlace(index, position, hole);
+}
+
+
+/*
+================================================================================
+PID TABLE (internal helpers)
+================================================================================
+*/
+
+static unsigned int bucketOf(BlockIndex *index, int processID) {
+    // Multiplicative hash spreads neighbouring PIDs over the table
+    return ((unsigned int)processID * 2654435761u) & (index->numBuckets - 1);
+}
+
+static void pidInsert(BlockIndex *index, MemoryBlock *block) {
+    unsigned int b = bucketOf(index, block->processID);
+    block->pidNext = index->pidBuckets[b];
+    index->pidBuckets[b] = block;
+    index->numIndexed++;
+}
+
+// Double the table when it holds more blocks than buckets
+static void pidGrow(BlockIndex *index) {
+    int oldCount = index->numBuckets;
+    MemoryBlock **old = index->pidBuckets;
+    MemoryBlock **bigger = (MemoryBlock **)calloc(oldCount * 2, sizeof(MemoryBlock *));
+
+    if (bigger == NULL) {
+        return;         // Keep the old table - just longer chains
+    }
+
+    index->pidBuckets = bigger;
+    index->numBuckets = oldCount * 2;
+    index->numIndexed = 0;
+    for (int b = 0; b < oldCount; b++) {
+        MemoryBlock *block = old[b];
+        while (block != NULL) {
+            MemoryBlock *following = block->pidNext;
+            pidInsert(index, block);
+            block = following;
+        }
+    }
+    free(old);
+}
+
+
+/*
+================================================================================
+VICTIM ORDER (internal helpers)
+================================================================================
+The LRU list is a plain doubly linked list. The size treap has the same
+shape as the address index (address_index.c), keyed by (size, address)
+so no two processes tie.
+*/
+
+static int isListed(BlockIndex *index, MemoryBlock *block) {
+    return block->lruOlder != NULL || index->lruOldest == block;
+}
+
+static void lruAppend(BlockIndex *index, MemoryBlock *block) {
+    block->lruOlder = index->lruNewest;
+    block->lruNewer = NULL;
+    if (index->lruNewest != NULL) {
+        index->lruNewest->lruNewer = block;
+    } else {
+        index->lruOldest = block;
+    }
+    index->lruNewest = block;
+}
+
+static void lruUnlink(BlockIndex *index, MemoryBlock *block) {
+    if (block->lruOlder != NULL) {
+        block->lruOlder->lruNewer = block->lruNewer;
+    } else {
+        index->lruOldest = block->lruNewer;
+    }
+    if (block->lruNewer != NULL) {
+        block->lruNewer->lruOlder = block->lruOlder;
+    } else {
+        index->lruNewest = block->lruOlder;
+    }
+    block->lruOlder = NULL;
+    block->lruNewer = NULL;
+}
+
+// Is block a before block b in (size, address) order?
+static int sizeBefore(MemoryBlock *a, MemoryBlock *b) {
+    return a->size < b->size || (a->size == b->size && a->startAddress < b->startAddress);
+}
+
+static MemoryBlock *sizeInsert(MemoryBlock *root, MemoryBlock *node) {
+    if (root == NULL) {
+        return node;
+    }
+
+    if (sizeBefore(node, root)) {
+        root->sizeLeft = sizeInsert(root->sizeLeft, node);
+        if (root->sizeLeft->sizePriority > root->sizePriority) {
+            MemoryBlock *l = root->sizeLeft;       // Rotate right
+            root->sizeLeft = l->sizeRight;
+            l->sizeRight = root;
+            return l;
+        }
+    } else {
+        root->sizeRight = sizeInsert(root->sizeRight, node);
+        if (root->sizeRight->sizePriority > root->sizePriority) {
+            MemoryBlock *r = root->sizeRight;      // Rotate left
+            root->sizeRight = r->sizeLeft;
+            r->sizeLeft = root;
+            return r;
+        }
+    }
+    return root;
+}
+
+static MemoryBlock *sizeJoin(MemoryBlock *a, MemoryBlock *b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    if (a->sizePriority > b->sizePriority) {
+        a->sizeRight = sizeJoin(a->sizeRight, b);
+        return a;
+    }
+    b->sizeLeft = sizeJoin(a, b->sizeLeft);
+    return b;
+}
+
+static MemoryBlock *sizeRemove(MemoryBlock *root, MemoryBlock *node) {
+    if (root == node) {
+        return sizeJoin(node->sizeLeft, node->sizeRight);
+    }
+    if (sizeBefore(node, root)) {
+        root->sizeLeft = sizeRemove(root->sizeLeft, node);
+    } else {
+        root->sizeRight = sizeRemove(root->sizeRight, node);
+    }
+    return root;
+}
+
+// xorshift - fast, and good enough for balancing
+static unsigned int nextPriority(BlockIndex *index) {
+    unsigned int x = index->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    index->seed = x;
+    return x;
+}
+
+// Put a process on both victim structures / take it off both
+static void victimAdd(BlockIndex *index, MemoryBlock *block) {
+    lruAppend(index, block);
+    block->sizeLeft = NULL;
+    block->sizeRight = NULL;
+    block->sizePriority = nextPriority(index);
+    index->sizeRoot = sizeInsert(index->sizeRoot, block);
+}
+
+static void victimRemove(BlockIndex *index, MemoryBlock *block) {
+    if (!isListed(index, block)) {
+        return;         // A segment - never listed
+    }
+    lruUnlink(index, block);
+    index->sizeRoot = sizeRemove(index->sizeRoot, block);
+    block->sizeLeft = NULL;
+    block->sizeRight = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: enableBlockIndex / disableBlockIndex
+================================================================================
+*/
+
+int enableBlockIndex(MemoryManager *mm, BlockIndex *index) {
+
+    // STEP 1: Room for every hole we have now (the heap grows later)
+    index->heapCapacity = mm->numHoles + 16;
+    index->heapSize = 0;
+    index->holeHeap = (MemoryBlock **)malloc(sizeof(MemoryBlock *) * index->heapCapacity);
+
+    index->numBuckets = 64;
+    while (index->numBuckets < mm->numProcesses) {
+        index->numBuckets *= 2;
+    }
+    index->numIndexed = 0;
+    index->pidBuckets = (MemoryBlock **)calloc(index->numBuckets, sizeof(MemoryBlock *));
+    index->tick = 0;
+    index->lruOldest = NULL;
+    index->lruNewest = NULL;
+    index->sizeRoot = NULL;
+    index->seed = 2463534242u;
+
+    if (index->holeHeap == NULL || index->pidBuckets == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(index->holeHeap);
+        free(index->pidBuckets);
+        return 0;
+    }
+
+    // STEP 2: Add every block (the loop order becomes the first LRU order)
+    mm->blockIndex = index;
+    for (MemoryBlock *b = mm->head; b != NULL; b = b->next) {
+        if (b->isHole) {
+            b->holeHeapIndex = -1;
+            indexHoleChanged(mm, b);
+        } else {
+            indexProcessAdded(mm, b);
+            if (b->segment != -1) {
+                indexProcessPinned(mm, b, 1);
+            }
+        }
+    }
+    return 1;
+}
+
+void disableBlockIndex(MemoryManager *mm) {
+    BlockIndex *index = mm->blockIndex;
+
+    if (index == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < index->heapSize; i++) {
+        index->holeHeap[i]->holeHeapIndex = -1;
+    }
+    while (index->lruOldest != NULL) {
+        victimRemove(index, index->lruOldest);
+    }
+    free(index->holeHeap);
+    free(index->pidBuckets);
+    index->holeHeap = NULL;
+    index->pidBuckets = NULL;
+    mm->blockIndex = NULL;
+}
+
+
+/*
+================================================================================
+LOOKUPS
+================================================================================
+*/
+
+MemoryBlock *indexFindProcess(MemoryManager *mm, int processID) {
+    BlockIndex *index = mm->blockIndex;
+    MemoryBlock *block = index->pidBuckets[bucketOf(index, processID)];
+
+    while (block != NULL && block->processID != processID) {
+        block = block->pidNext;
+    }
+    return block;
+}
+
+int largestHoleSize(MemoryManager *mm) {
+    if (mm->bitmap != NULL) {
+        return bitmapLargestRun(mm);
+    }
+    if (mm->compactPool != NULL) {
+        return compactLargestHole(mm->compactPool);
+    }
+    if (mm->blockIndex != NULL) {
+        return (mm->blockIndex->heapSize > 0) ? mm->blockIndex->holeHeap[0]->size : 0;
+    }
+    if (mm->holeTree != NULL) {
+        return holeTreeLargest(mm);
+    }
+
+    int largest = 0;
+    for (MemoryBlock *b = mm->firstHole; b != NULL; b = b->nextHole) {
+        if (b->size > largest) {
+            largest = b->size;
+        }
+    }
+    return largest;
+}
+
+int touchProcess(MemoryManager *mm, int processID) {
+    BlockIndex *index = mm->blockIndex;
+    if (index == NULL) {
+        return 0;
+    }
+    MemoryBlock *block = indexFindProcess(mm, processID);
+    if (block == NULL) {
+        return 0;
+    }
+
+    // Most recently used now: to the back of the LRU list
+    block->lastUsed = ++index->tick;
+    if (isListed(index, block)) {
+        lruUnlink(index, block);
+        lruAppend(index, block);
+    }
+    return 1;
+}
+
+MemoryBlock *indexLeastRecentlyUsed(MemoryManager *mm) {
+    return mm->blockIndex->lruOldest;
+}
+
+MemoryBlock *indexLargestProcess(MemoryManager *mm) {
+    MemoryBlock *node = mm->blockIndex->sizeRoot;
+
+    // Rightmost is the largest size (at its highest address); then the
+    // lowest address of that size, like the fit algorithms' tie-break
+    MemoryBlock *largest = NULL;
+    while (node != NULL) {
+        largest = node;
+        node = node->sizeRight;
+    }
+    return (largest != NULL) ? indexSmallestAtLeast(mm, largest->size) : NULL;
+}
+
+MemoryBlock *indexSmallestAtLeast(MemoryManager *mm, int size) {
+    MemoryBlock *node = mm->blockIndex->sizeRoot;
+    MemoryBlock *found = NULL;
+
+    while (node != NULL) {
+        if (node->size >= size) {
+            found = node;           // Candidate - look for a smaller one
+            node = node->sizeLeft;
+        } else {
+            node = node->sizeRight;
+        }
+    }
+    return found;
+}
+
+
+/*
+================================================================================
+UPDATES
+================================================================================
+*/
+
+void indexHoleChanged(MemoryManager *mm, MemoryBlock *hole) {
+    BlockIndex *index = mm->blockIndex;
+
+    if (index == NULL) {
+        return;
+    }
+
+    // Already in the heap: its size changed, move it up or down
+    if (hole->holeHeapIndex != -1) {
+        siftUp(index, hole->holeHeapIndex);
+        siftDown(index, hole->holeHeapIndex);
+        return;
+    }
+
+    // New hole: append, then move up
+    if (index->heapSize == index->heapCapacity) {
+        int newCapacity = index->heapCapacity * 2;
+        MemoryBlock **bigger = (MemoryBlock **)realloc(index->holeHeap,
+                                   sizeof(MemoryBlock *) * newCapacity);
+        if (bigger == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return;
+        }
+        index->holeHeap = bigger;
+        index->heapCapacity = newCapacity;
+    }
+    heapPlace(index, index->heapSize++, hole);
+    siftUp(index, hole->holeHeapIndex);
+}
+
+void indexHoleRemoved(MemoryManager *mm, MemoryBlock *hole) {
+    BlockIndex *index = mm->blockIndex;
+
+    if (index == NULL || hole->holeHeapIndex == -1) {
+        return;
+    }
+
+    // Move the last heap entry into the gap, then repair around it
+    int position = hole->holeHeapIndex;
+    MemoryBlock *last = index->holeHeap[--index->heapSize];
+    hole->holeHeapIndex = -1;
+
+    if (last != hole) {
+        heapPlace(index, position, last);
+        siftUp(index, position);
+        siftDown(index, last->holeHeapIndex);
+    }
+}
+
+void indexProcessAdded(MemoryManager *mm, MemoryBlock *block) {
+    BlockIndex *index = mm->blockIndex;
+
+    if (index == NULL) {
+        return;
+    }
+
+    if (index->numIndexed >= index->numBuckets) {
+        pidGrow(index);
+    }
+    pidInsert(index, block);
+    block->lastUsed = ++index->tick;
+    victimAdd(index, block);
+}
+
+void indexProcessRemoved(MemoryManager *mm, MemoryBlock *block) {
+    BlockIndex *index = mm->blockIndex;
+
+    if (index == NULL) {
+        return;
+    }
+
+    MemoryBlock **link = &index->pidBuckets[bucketOf(index, block->processID)];
+    while (*link != NULL && *link != block) {
+        link = &(*link)->pidNext;
+    }
+    if (*link == block) {
+        *link = block->pidNext;
+        block->pidNext = NULL;
+        index->numIndexed--;
+    }
+    victimRemove(index, block);
+}
+
+void indexProcessPinned(MemoryManager *mm, MemoryBlock *block, int pinned) {
+    BlockIndex *index = mm->blockIndex;
+
+    if (index == NULL || block->isHole) {
+        return;
+    }
+    if (pinned) {
+        victimRemove(index, block);
+    } else if (!isListed(index, block)) {
+        victimAdd(index, block);
+    }
+}
+
+void indexRestoreUse(MemoryManager *mm, MemoryBlock *block,
+                     MemoryBlock *usedBefore, long lastUsed) {
+    BlockIndex *index = mm->blockIndex;
+
+    block->lastUsed = lastUsed;
+    if (index == NULL || !isListed(index, block)) {
+        return;
+    }
+
+    // Off the back (where binding put it), in again after 'usedBefore'
+    lruUnlink(index, block);
+    block->lruOlder = usedBefore;
+    block->lruNewer = (usedBefore != NULL) ? usedBefore->lruNewer : index->lruOldest;
+    if (block->lruOlder != NULL) {
+        block->lruOlder->lruNewer = block;
+    } else {
+        index->lruOldest = block;
+    }
+    if (block->lruNewer != NULL) {
+        block->lruNewer->lruOlder = block;
+    } else {
+        index->lruNewest = block;
+    }
+}
+
+
+/*
+================================================================================
+END OF FILE: block_index.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableBlockIndex() / disableBlockIndex()
+2. Hole max-heap: siftUp/siftDown, indexHoleChanged/indexHoleRemoved
+3. PID hash table: pidInsert/pidGrow, indexProcessAdded/indexProcessRemoved
+4. indexFindProcess() / largestHoleSize() / touchProcess()
+5. Victim order: LRU list + size treap, indexLeastRecentlyUsed() /
+   indexLargestProcess() / indexSmallestAtLeast()
+6. indexProcessPinned() / indexRestoreUse() - Segments and moved processes
+================================================================================
+*/
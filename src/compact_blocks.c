@@ -0,0 +1,586 @@
+/*
+================================================================================
+FILE: compact_blocks.c
+PURPOSE: Implement the 16-byte block pool and its First / Best / Worst Fit
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/compact_blocks.h"
+#include "../include/usage_map.h"
+
+// Blocks printed by displayCompactPool() before "... N more"
+#define COMPACT_DISPLAY_LIMIT 16
+
+
+/*
+================================================================================
+BLOCK HELPERS
+================================================================================
+*/
+
+int compactBlockSize(const CompactBlock *block) {
+    return (int)(block->sizeAndFlag & ~COMPACT_HOLE_BIT);
+}
+
+int compactBlockIsHole(const CompactBlock *block) {
+    return (block->sizeAndFlag & COMPACT_HOLE_BIT) != 0;
+}
+
+static void setBlockSize(CompactBlock *block, int size, int isHole) {
+    block->sizeAndFlag = (unsigned int)size | (isHole ? COMPACT_HOLE_BIT : 0);
+}
+
+
+/*
+================================================================================
+POOL ENTRIES (internal)
+================================================================================
+NOTE: newEntry() may move the whole pool (realloc), so callers hold
+indices across it, never CompactBlock pointers.
+*/
+
+static unsigned int newEntry(CompactPool *pool) {
+
+    // Reuse an entry a merge gave back
+    if (pool->freeEntry != COMPACT_NONE) {
+        unsigned int entry = pool->freeEntry;
+        pool->freeEntry = pool->blocks[entry].next;
+        return entry;
+    }
+
+    // Pool full: double it (indices stay valid, pointers do not)
+    if (pool->used == pool->capacity) {
+        unsigned int newCapacity = (pool->capacity < COMPACT_NONE / 2) ?
+                                   pool->capacity * 2 : COMPACT_NONE - 1;
+        if (newCapacity <= pool->capacity) {
+            return COMPACT_NONE;
+        }
+        CompactBlock *bigger = (CompactBlock *)realloc(pool->blocks,
+                                                       sizeof(CompactBlock) * newCapacity);
+        if (bigger == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return COMPACT_NONE;
+        }
+        pool->blocks = bigger;
+        pool->capacity = newCapacity;
+    }
+    return pool->used++;
+}
+
+static void releaseEntry(CompactPool *pool, unsigned int entry) {
+    pool->blocks[entry].next = pool->freeEntry;
+    pool->freeEntry = entry;
+}
+
+
+/*
+================================================================================
+FUNCTION: initCompactPool / freeCompactPool
+================================================================================
+*/
+
+int initCompactPool(CompactPool *pool, int totalMem, int osMem, unsigned int expectedBlocks) {
+    pool->capacity = (expectedBlocks > 16) ? expectedBlocks : 16;
+    pool->blocks = (CompactBlock *)malloc(sizeof(CompactBlock) * pool->capacity);
+    if (pool->blocks == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    pool->totalMemory = totalMem;
+    pool->osMemory = osMem;
+    pool->userMemory = totalMem - osMem;
+    pool->freeMemory = pool->userMemory;
+    pool->numProcesses = 0;
+    pool->numHoles = 1;
+
+    // Entry 0: one hole over all of user memory
+    pool->blocks[0].startAddress = (unsigned int)osMem;
+    setBlockSize(&pool->blocks[0], pool->userMemory, 1);
+    pool->blocks[0].next = COMPACT_NONE;
+    pool->blocks[0].processID = -1;
+    pool->used = 1;
+    pool->freeEntry = COMPACT_NONE;
+    pool->head = 0;
+    pool->firstHole = 0;
+    return 1;
+}
+
+void freeCompactPool(CompactPool *pool) {
+    free(pool->blocks);
+    pool->blocks = NULL;
+    pool->capacity = 0;
+    pool->used = 0;
+}
+
+
+/*
+================================================================================
+FUNCTION: compactAllocate
+================================================================================
+*/
+
+int compactAllocate(CompactPool *pool, int processID, int size, AllocationAlgorithm algo) {
+    if (size <= 0 || size > pool->freeMemory) {
+        return -1;
+    }
+
+    // STEP 1: Choose a hole - the same rules as firstFit() / bestFit() /
+    //         worstFit(), ties going to the lowest address
+    unsigned int chosen = COMPACT_NONE;
+    int chosenSize = 0;
+    for (unsigned int i = pool->firstHole; i != COMPACT_NONE; i = pool->blocks[i].next) {
+        CompactBlock *block = &pool->blocks[i];
+        int holeSize = compactBlockSize(block);
+        if (!compactBlockIsHole(block) || holeSize < size) {
+            continue;
+        }
+        if (algo == FIRST_FIT) {
+            chosen = i;
+            break;
+        }
+        if (chosen == COMPACT_NONE ||
+            (algo == BEST_FIT && holeSize < chosenSize) ||
+            (algo == WORST_FIT && holeSize > chosenSize)) {
+            chosen = i;
+            chosenSize = holeSize;
+        }
+    }
+    if (chosen == COMPACT_NONE) {
+        return -1;
+    }
+
+    // STEP 2: Bigger than needed → the rest becomes a new hole after it
+    unsigned int rest = COMPACT_NONE;
+    if (compactBlockSize(&pool->blocks[chosen]) > size) {
+        rest = newEntry(pool);
+        if (rest == COMPACT_NONE) {
+            return -1;
+        }
+        CompactBlock *hole = &pool->blocks[chosen];
+        CompactBlock *after = &pool->blocks[rest];
+        after->startAddress = hole->startAddress + (unsigned int)size;
+        setBlockSize(after, compactBlockSize(hole) - size, 1);
+        after->next = hole->next;
+        after->processID = -1;
+        hole->next = rest;
+    } else {
+        pool->numHoles--;
+    }
+
+    // STEP 3: Hand the block to the process
+    CompactBlock *block = &pool->blocks[chosen];
+    setBlockSize(block, size, 0);
+    block->processID = processID;
+    pool->freeMemory -= size;
+    pool->numProcesses++;
+
+    // STEP 4: If that was the first hole, find the new first hole
+    if (chosen == pool->firstHole) {
+        unsigned int i = (rest != COMPACT_NONE) ? rest : block->next;
+        while (i != COMPACT_NONE && !compactBlockIsHole(&pool->blocks[i])) {
+            i = pool->blocks[i].next;
+        }
+        pool->firstHole = i;
+    }
+    return (int)block->startAddress;
+}
+
+
+/*
+================================================================================
+FUNCTION: compactDeallocate
+================================================================================
+PURPOSE: Find the process (remembering the block before it), turn it
+         into a hole and merge it with hole neighbours
+
+There is no 'prev' field - the walk that finds the block already knows
+the one before it. *start / *size get where the process was.
+*/
+
+static int freeProcess(CompactPool *pool, int processID, int *start, int *size) {
+    unsigned int prev = COMPACT_NONE;
+    unsigned int i = pool->head;
+
+    // STEP 1: Find the process
+    while (i != COMPACT_NONE &&
+           (compactBlockIsHole(&pool->blocks[i]) || pool->blocks[i].processID != processID)) {
+        prev = i;
+        i = pool->blocks[i].next;
+    }
+    if (i == COMPACT_NONE) {
+        return 0;
+    }
+
+    // STEP 2: Now a hole
+    CompactBlock *block = &pool->blocks[i];
+    *start = (int)block->startAddress;
+    *size = compactBlockSize(block);
+    setBlockSize(block, *size, 1);
+    block->processID = -1;
+    pool->freeMemory += *size;
+    pool->numProcesses--;
+    pool->numHoles++;
+
+    // STEP 3: Swallow the hole after it
+    unsigned int next = block->next;
+    if (next != COMPACT_NONE && compactBlockIsHole(&pool->blocks[next])) {
+        setBlockSize(block, compactBlockSize(block) + compactBlockSize(&pool->blocks[next]), 1);
+        block->next = pool->blocks[next].next;
+        releaseEntry(pool, next);
+        pool->numHoles--;
+        if (pool->firstHole == next) {
+            pool->firstHole = i;
+        }
+    }
+
+    // STEP 4: Be swallowed by the hole before it
+    if (prev != COMPACT_NONE && compactBlockIsHole(&pool->blocks[prev])) {
+        CompactBlock *before = &pool->blocks[prev];
+        setBlockSize(before, compactBlockSize(before) + compactBlockSize(block), 1);
+        before->next = block->next;
+        if (pool->firstHole == i) {
+            pool->firstHole = prev;
+        }
+        releaseEntry(pool, i);
+        pool->numHoles--;
+        i = prev;
+    }
+
+    // STEP 5: A hole below the first hole is the new first hole
+    if (pool->firstHole == COMPACT_NONE ||
+        pool->blocks[i].startAddress < pool->blocks[pool->firstHole].startAddress) {
+        pool->firstHole = i;
+    }
+    return 1;
+}
+
+int compactDeallocate(CompactPool *pool, int processID) {
+    int start;
+    int size;
+    return freeProcess(pool, processID, &start, &size);
+}
+
+
+/*
+================================================================================
+FUNCTION: enableCompactBackend / disableCompactBackend
+================================================================================
+*/
+
+int enableCompactBackend(MemoryManager *mm, CompactPool *pool, unsigned int expectedBlocks) {
+
+    // STEP 1: Validate
+    if (mm->numProcesses > 0) {
+        printf("Error: The compact backend needs empty memory!\n");
+        return 0;
+    }
+    if (mm->segments != NULL) {
+        printf("Error: Segment tables point at blocks - disable segmentation first!\n");
+        return 0;
+    }
+    if (mm->bitmap != NULL) {
+        printf("Error: Memory is already a bitmap - use one backend only!\n");
+        return 0;
+    }
+
+    // STEP 2: One hole over user memory, as in the block list
+    if (!initCompactPool(pool, mm->totalMemory, mm->osMemory, expectedBlocks)) {
+        return 0;
+    }
+    mm->freeMemory = pool->freeMemory;
+    mm->numHoles = pool->numHoles;
+    mm->compactPool = pool;
+    return 1;
+}
+
+void disableCompactBackend(MemoryManager *mm) {
+    if (mm->compactPool == NULL) {
+        return;
+    }
+    freeCompactPool(mm->compactPool);
+    mm->compactPool = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: compactBackendAllocate / compactBackendFree / compactProcessAt
+================================================================================
+The pool keeps its own totals; the manager's are copied from it.
+*/
+
+static void copyTotals(MemoryManager *mm, CompactPool *pool) {
+    mm->freeMemory = pool->freeMemory;
+    mm->numProcesses = pool->numProcesses;
+    mm->numHoles = pool->numHoles;
+}
+
+int compactBackendAllocate(MemoryManager *mm, int processID, int size, AllocationAlgorithm algo) {
+    int address = compactAllocate(mm->compactPool, processID, size, algo);
+
+    if (address != -1) {
+        copyTotals(mm, mm->compactPool);
+        usageMapUpdate(mm, address, size, 1);
+    }
+    return address;
+}
+
+int compactBackendFree(MemoryManager *mm, int processID) {
+    int start;
+    int size;
+
+    if (!freeProcess(mm->compactPool, processID, &start, &size)) {
+        return 0;
+    }
+    copyTotals(mm, mm->compactPool);
+    usageMapUpdate(mm, start, size, -1);
+    return 1;
+}
+
+int compactProcessAt(CompactPool *pool, int address) {
+    // Blocks are in address order - stop once past the address
+    for (unsigned int i = pool->head; i != COMPACT_NONE; i = pool->blocks[i].next) {
+        CompactBlock *block = &pool->blocks[i];
+        if ((int)block->startAddress > address) {
+            break;
+        }
+        if ((int)block->startAddress == address && !compactBlockIsHole(block)) {
+            return block->processID;
+        }
+    }
+    return -1;
+}
+
+
+/*
+================================================================================
+FUNCTION: compactLargestHole / compactFragmentation
+================================================================================
+*/
+
+int compactLargestHole(CompactPool *pool) {
+    int largest = 0;
+    for (unsigned int i = pool->firstHole; i != COMPACT_NONE; i = pool->blocks[i].next) {
+        if (compactBlockIsHole(&pool->blocks[i]) && compactBlockSize(&pool->blocks[i]) > largest) {
+            largest = compactBlockSize(&pool->blocks[i]);
+        }
+    }
+    return largest;
+}
+
+float compactFragmentation(CompactPool *pool) {
+    if (pool->freeMemory == 0) {
+        return 0.0;
+    }
+    return (float)(pool->freeMemory - compactLargestHole(pool)) / pool->userMemory * 100;
+}
+
+
+/*
+================================================================================
+FUNCTION: compactMetadataBytes / listMetadataBytes
+================================================================================
+*/
+
+long compactMetadataBytes(CompactPool *pool) {
+    return (long)pool->capacity * sizeof(CompactBlock);
+}
+
+long listMetadataBytes(long blocks) {
+    // malloc keeps a size word in front of every allocation and rounds
+    // the total up to a multiple of 16
+    long perBlock = ((long)sizeof(MemoryBlock) + sizeof(size_t) + 15) / 16 * 16;
+    return blocks * perBlock;
+}
+
+
+/*
+================================================================================
+FUNCTION: displayCompactPool
+================================================================================
+*/
+
+void displayCompactPool(CompactPool *pool) {
+    long blocks = pool->numProcesses + pool->numHoles;
+    int shown = 0;
+
+    // STEP 1: The first few blocks
+    for (unsigned int i = pool->head; i != COMPACT_NONE; i = pool->blocks[i].next) {
+        CompactBlock *block = &pool->blocks[i];
+        if (shown == COMPACT_DISPLAY_LIMIT) {
+            printf("... %ld more", blocks - shown);
+            break;
+        }
+        int end = (int)block->startAddress + compactBlockSize(block) - 1;
+        if (compactBlockIsHole(block)) {
+            printf("[%u-%d hole] ", block->startAddress, end);
+        } else {
+            printf("[%u-%d P%d] ", block->startAddress, end, block->processID);
+        }
+        shown++;
+    }
+    printf("\n");
+
+    // STEP 2: Totals and what the bookkeeping costs
+    printf("Processes: %d | Holes: %d | Free: %d KB | Fragmentation: %.2f%%\n",
+           pool->numProcesses, pool->numHoles, pool->freeMemory, compactFragmentation(pool));
+    printf("Metadata: %ld bytes for %ld blocks = %.1f bytes/block (%d per entry, %u entries)\n",
+           compactMetadataBytes(pool), blocks, (double)compactMetadataBytes(pool) / blocks,
+           (int)sizeof(CompactBlock), pool->capacity);
+    printf("Block list: %ld bytes = %.1f bytes/block\n",
+           listMetadataBytes(blocks), (double)listMetadataBytes(blocks) / blocks);
+}
+
+
+/*
+================================================================================
+FUNCTION: compareLayouts
+================================================================================
+*/
+
+typedef struct LayoutRun {
+    int placed;
+    double milliseconds;
+    double bytesPerBlock;
+} LayoutRun;
+
+// One workload on either 'mm' or 'pool' (the other is NULL);
+// addresses[op] gets each result (-2 = free)
+static LayoutRun runLayoutWorkload(MemoryManager *mm, CompactPool *pool,
+                                   AllocationAlgorithm algo, int numOps,
+                                   unsigned int seed, int *addresses) {
+    LayoutRun run = {0, 0.0, 0.0};
+    int *live = (int *)malloc(sizeof(int) * (numOps + 1));
+    int numLive = 0;
+    int nextPID = 1;
+    unsigned int state = seed;
+
+    if (live == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return run;
+    }
+
+    clock_t start = clock();
+    for (int op = 0; op < numOps; op++) {
+        state = state * 1103515245u + 12345u;
+        unsigned int r = state >> 8;
+
+        if (numLive > 0 && r % 3 == 0) {
+            // Free a random live process
+            int i = (int)((r / 3) % (unsigned int)numLive);
+            if (mm != NULL) {
+                deallocateMemory(mm, live[i]);
+            } else {
+                compactDeallocate(pool, live[i]);
+            }
+            live[i] = live[--numLive];
+            addresses[op] = -2;
+        } else {
+            // 1 - 64 KB; only when the total fits (no error messages)
+            int size = 1 + (int)((r / 3) % 64);
+            int address = -1;
+            if (mm != NULL && size <= mm->freeMemory) {
+                address = allocateMemory(mm, nextPID, size, algo);
+            } else if (pool != NULL) {
+                address = compactAllocate(pool, nextPID, size, algo);
+            }
+            if (address != -1) {
+                live[numLive++] = nextPID;
+                run.placed++;
+            }
+            addresses[op] = address;
+            nextPID++;
+        }
+    }
+    run.milliseconds = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    if (mm != NULL) {
+        long blocks = mm->numProcesses + mm->numHoles;
+        run.bytesPerBlock = (double)listMetadataBytes(blocks) / blocks;
+    } else {
+        run.bytesPerBlock = (double)compactMetadataBytes(pool)
+                          / (pool->numProcesses + pool->numHoles);
+    }
+    free(live);
+    return run;
+}
+
+void compareLayouts(int userMemory, int numOps, unsigned int seed) {
+    const char *names[] = {"First Fit", "Best Fit", "Worst Fit"};
+    LayoutRun results[3][2];
+    int same[3];
+    int *listAddresses = (int *)malloc(sizeof(int) * numOps);
+    int *compactAddresses = (int *)malloc(sizeof(int) * numOps);
+
+    if (listAddresses == NULL || compactAddresses == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(listAddresses);
+        free(compactAddresses);
+        return;
+    }
+
+    // STEP 1: Same requests on both layouts, for each algorithm
+    for (int algo = FIRST_FIT; algo <= WORST_FIT; algo++) {
+        MemoryManager listMM;
+        CompactPool pool;
+
+        initializeMemory(&listMM, 256 + userMemory, 256);
+        results[algo][0] = runLayoutWorkload(&listMM, NULL, (AllocationAlgorithm)algo,
+                                             numOps, seed, listAddresses);
+        freeMemoryManager(&listMM);
+
+        if (!initCompactPool(&pool, 256 + userMemory, 256, 0)) {
+            free(listAddresses);
+            free(compactAddresses);
+            return;
+        }
+        results[algo][1] = runLayoutWorkload(NULL, &pool, (AllocationAlgorithm)algo,
+                                             numOps, seed, compactAddresses);
+        freeCompactPool(&pool);
+
+        same[algo] = 1;
+        for (int op = 0; op < numOps; op++) {
+            if (listAddresses[op] != compactAddresses[op]) {
+                same[algo] = 0;
+                break;
+            }
+        }
+    }
+
+    // STEP 2: One table
+    printf("\n%d random steps over %d KB:\n", numOps, userMemory);
+    printf("Algorithm  Layout   Placed  Time (ms)  Bytes/block  Same\n");
+    for (int algo = FIRST_FIT; algo <= WORST_FIT; algo++) {
+        for (int l = 0; l < 2; l++) {
+            printf("%-10s %-8s %-7d %-10.2f %-12.1f %s\n", names[algo], l ? "Compact" : "List",
+                   results[algo][l].placed, results[algo][l].milliseconds,
+                   results[algo][l].bytesPerBlock, l ? (same[algo] ? "yes" : "no") : "");
+        }
+    }
+
+    free(listAddresses);
+    free(compactAddresses);
+}
+
+
+/*
+================================================================================
+END OF FILE: compact_blocks.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. initCompactPool() / freeCompactPool() - One array, entries linked by index
+2. compactAllocate() - First / Best / Worst Fit from the first hole
+3. compactDeallocate() - Free + merge without a 'prev' field
+   enableCompactBackend() / compactBackendAllocate() / compactBackendFree()
+   - The pool behind allocateMemory() / deallocateMemory()
+4. compactLargestHole() / compactFragmentation() - Totals
+5. compactMetadataBytes() / listMetadataBytes() - Bytes per block, both ways
+6. displayCompactPool() - First blocks + metadata report
+7. compareLayouts() - Same workload on list and pool, side by side
+================================================================================
+*/
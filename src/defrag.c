@@ -0,0 +1,380 @@
+/*
+================================================================================
+FILE: defrag.c
+PURPOSE: Implement incremental compaction with a KB budget per step
+DESCRIPTION:
+    A move is RELEASE + MERGE + SPLIT + BIND, like resizeMemory()'s
+    "slide down" case, so the event log can replay compaction without
+    knowing about it.
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/defrag.h"
+#include "../include/block_index.h"
+#include "../include/hole_tree.h"
+#include "../include/admission_queue.h"
+#include "../include/shared_view.h"
+
+
+/*
+================================================================================
+FUNCTION: enableDefragmenter / disableDefragmenter
+================================================================================
+*/
+
+int enableDefragmenter(MemoryManager *mm, Defragmenter *defrag,
+                       int budgetKB, double tickInterval) {
+    if (budgetKB <= 0) {
+        if (isVerbose()) {
+            printf("Error: Compaction budget must be positive!\n");
+        }
+        return 0;
+    }
+    if (mm->bitmap != NULL || mm->compactPool != NULL) {
+        if (isVerbose()) {
+            printf("Error: The %s backend has no blocks to move!\n",
+                   (mm->bitmap != NULL) ? "bitmap" : "compact");
+        }
+        return 0;
+    }
+
+    defrag->budgetKB = budgetKB;
+    defrag->tickInterval = (tickInterval > 0) ? tickInterval : 0.0;
+    defrag->nextTick = defrag->tickInterval;
+    defrag->cursor = 0;
+    defrag->running = 0;
+
+    defrag->steps = 0;
+    defrag->moves = 0;
+    defrag->kbMoved = 0;
+    defrag->maxStepKB = 0;
+    defrag->holesMerged = 0;
+    defrag->fragmentationRemoved = 0.0;
+
+    mm->defragmenter = defrag;
+    return 1;
+}
+
+void disableDefragmenter(MemoryManager *mm) {
+    mm->defragmenter = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: resumeHole (internal helper)
+================================================================================
+PURPOSE: The hole at 'cursor', or the first hole after it
+
+Since the last step, the hole at the cursor may have grown downwards
+(a free below it), been filled (an allocation), or be gone completely.
+Any of these is fine: we take the hole that contains the cursor, or
+the next one up.
+*/
+
+static MemoryBlock *resumeHole(MemoryManager *mm, int cursor) {
+    MemoryBlock *hole = mm->firstHole;
+    if (hole == NULL || hole->startAddress >= cursor) {
+        return hole;
+    }
+
+    // Highest hole starting at or below the cursor
+    if (mm->holeTree != NULL) {
+        hole = holeTreeHoleBefore(mm, cursor + 1);      // O(log n)
+    } else {
+        while (hole->nextHole != NULL && hole->nextHole->startAddress <= cursor) {
+            hole = hole->nextHole;
+        }
+    }
+
+    // It ends below the cursor - the cursor's hole was filled since
+    if (hole->endAddress < cursor) {
+        hole = hole->nextHole;
+    }
+    return hole;
+}
+
+
+/*
+================================================================================
+FUNCTION: slideDown (internal helper)
+================================================================================
+PURPOSE: Move 'block' (a process) into the hole right before it
+
+[HOLE: 50][P2: 100][HOLE: 30] → [P2: 100][HOLE: 80]
+
+The process keeps the first MemoryBlock (the old hole); the block it
+used to be in is merged away. Returns the hole now after the process.
+*/
+
+static MemoryBlock *slideDown(MemoryManager *mm, MemoryBlock *block) {
+    MemoryBlock *hole = block->prev;
+    int processID = block->processID;
+    int size = block->size;
+    long lastUsed = block->lastUsed;
+    MemoryBlock *usedBefore = block->lruOlder;
+
+    // STEP 1: Old copy becomes part of the hole (and so does a hole after it)
+    unbindBlock(mm, block);
+    mergeWithNext(mm, hole);
+    if (hole->next != NULL && hole->next->isHole) {
+        mergeWithNext(mm, hole);
+    }
+
+    // STEP 2: New copy at the bottom of the hole (memmove in a real system)
+    placeProcess(mm, hole, processID, size);
+
+    // Moving a process is not using it (LRU swapping must not notice)
+    indexRestoreUse(mm, hole, usedBefore, lastUsed);
+    return hole->next;
+}
+
+
+/*
+================================================================================
+FUNCTION: defragStep
+================================================================================
+*/
+
+int defragStep(MemoryManager *mm) {
+    Defragmenter *defrag = mm->defragmenter;
+    if (defrag == NULL || defrag->running || mm->bitmap != NULL || mm->compactPool != NULL) {
+        return 0;
+    }
+    defrag->running = 1;
+
+    int holesBefore = mm->numHoles;
+    float fragmentationBefore = -1.0f;  // Measured just before the first change
+    int moved = 0;
+    MemoryBlock *hole = resumeHole(mm, defrag->cursor);
+
+    for (int visits = 0; hole != NULL && visits < DEFRAG_MAX_VISITS; visits++) {
+        MemoryBlock *block = hole->next;
+
+        // STEP 1: Top of memory - the next step starts a new pass
+        if (block == NULL) {
+            hole = NULL;
+            break;
+        }
+        if (fragmentationBefore < 0 && (block->isHole || block->size <= defrag->budgetKB - moved)) {
+            fragmentationBefore = calculateFragmentation(mm);
+        }
+
+        // STEP 2: Two holes side by side (deferred coalescing) - join them
+        if (block->isHole) {
+            mergeWithNext(mm, hole);
+            continue;
+        }
+
+        // STEP 3: Can never be moved - carry on from the next hole
+        if (block->segment != -1 || block->size > defrag->budgetKB) {
+            hole = hole->nextHole;
+            continue;
+        }
+
+        // STEP 4: Not enough budget left in this step - resume here next time
+        if (block->size > defrag->budgetKB - moved) {
+            break;
+        }
+
+        // STEP 5: Move it down; the hole is now after it
+        moved += block->size;
+        defrag->moves++;
+        hole = slideDown(mm, block);
+    }
+
+    defrag->cursor = (hole != NULL) ? hole->startAddress : 0;
+
+    // STEP 6: Statistics; bigger holes may let waiting requests in
+    defrag->holesMerged += holesBefore - mm->numHoles;
+    if (fragmentationBefore >= 0) {
+        defrag->fragmentationRemoved += fragmentationBefore - calculateFragmentation(mm);
+    }
+    if (moved > 0) {
+        defrag->steps++;
+        defrag->kbMoved += moved;
+        if (moved > defrag->maxStepKB) {
+            defrag->maxStepKB = moved;
+        }
+        admitPendingRequests(mm, -1);
+        publishSharedView(mm, 0);
+    }
+
+    defrag->running = 0;
+    return moved;
+}
+
+
+/*
+================================================================================
+FUNCTION: defragOnOperation / defragAdvanceClock
+================================================================================
+*/
+
+void defragOnOperation(MemoryManager *mm) {
+    if (mm->defragmenter != NULL && mm->defragmenter->tickInterval == 0) {
+        defragStep(mm);
+    }
+}
+
+void defragAdvanceClock(MemoryManager *mm, double now) {
+    Defragmenter *defrag = mm->defragmenter;
+    if (defrag == NULL || defrag->tickInterval == 0) {
+        return;
+    }
+
+    while (defrag->nextTick <= now) {
+        int moved = defragStep(mm);
+        defrag->nextTick += defrag->tickInterval;
+
+        // Nothing to move - later ticks up to 'now' would find nothing either
+        if (moved == 0 && defrag->nextTick <= now) {
+            long missed = (long)((now - defrag->nextTick) / defrag->tickInterval) + 1;
+            defrag->nextTick += missed * defrag->tickInterval;
+        }
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: displayDefragStats
+================================================================================
+*/
+
+void displayDefragStats(MemoryManager *mm) {
+    Defragmenter *defrag = mm->defragmenter;
+    if (defrag == NULL) {
+        return;
+    }
+
+    if (defrag->tickInterval > 0) {
+        printf("Defragmenter: %d KB every %.2f time units\n",
+               defrag->budgetKB, defrag->tickInterval);
+    } else {
+        printf("Defragmenter: %d KB per operation\n", defrag->budgetKB);
+    }
+    printf("Moved %ld processes (%ld KB) in %ld steps, at most %d KB per step\n",
+           defrag->moves, defrag->kbMoved, defrag->steps, defrag->maxStepKB);
+    printf("Holes merged: %ld | Fragmentation removed: %.2f points",
+           defrag->holesMerged, defrag->fragmentationRemoved);
+    if (defrag->kbMoved > 0) {
+        printf(" (%.3f per MB moved)", defrag->fragmentationRemoved * 1024 / defrag->kbMoved);
+    }
+    printf("\n");
+}
+
+
+/*
+================================================================================
+FUNCTION: compareDefragBudgets
+================================================================================
+*/
+
+typedef struct BudgetRun {
+    int placed;
+    double averageFragmentation;
+    long kbMoved;
+    int maxStepKB;
+    double removedPerMB;
+} BudgetRun;
+
+// budgetKB = 0 runs without a defragmenter
+static BudgetRun runBudgetWorkload(int userMemory, int budgetKB, int numOps,
+                                   unsigned int seed) {
+    BudgetRun run = {0, 0.0, 0, 0, 0.0};
+    MemoryManager mm;
+    BlockIndex index;
+    Defragmenter defrag;
+    int *live = (int *)malloc(sizeof(int) * (numOps + 1));
+    int numLive = 0;
+    int nextPID = 1;
+    unsigned int state = seed;
+    double fragmentationSum = 0.0;
+
+    if (live == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return run;
+    }
+
+    // A BlockIndex keeps calculateFragmentation() O(1) for the sampling
+    initializeMemory(&mm, 256 + userMemory, 256);
+    enableBlockIndex(&mm, &index);
+    if (budgetKB > 0) {
+        enableDefragmenter(&mm, &defrag, budgetKB, 0);
+    }
+
+    for (int op = 0; op < numOps; op++) {
+        state = state * 1103515245u + 12345u;
+        unsigned int r = state >> 8;
+
+        if (numLive > 0 && r % 3 == 0) {
+            // Free a random live process
+            int i = (int)((r / 3) % (unsigned int)numLive);
+            deallocateMemory(&mm, live[i]);
+            live[i] = live[--numLive];
+        } else {
+            // 1 - 128 KB; only when the total fits (no error messages)
+            int size = 1 + (int)((r / 3) % 128);
+            if (size <= mm.freeMemory && allocateMemory(&mm, nextPID, size, FIRST_FIT) != -1) {
+                live[numLive++] = nextPID;
+                run.placed++;
+            }
+            nextPID++;
+        }
+        fragmentationSum += calculateFragmentation(&mm);
+    }
+
+    run.averageFragmentation = fragmentationSum / numOps;
+    if (budgetKB > 0) {
+        run.kbMoved = defrag.kbMoved;
+        run.maxStepKB = defrag.maxStepKB;
+        if (defrag.kbMoved > 0) {
+            run.removedPerMB = defrag.fragmentationRemoved * 1024 / defrag.kbMoved;
+        }
+    }
+    freeMemoryManager(&mm);
+    free(live);
+    return run;
+}
+
+void compareDefragBudgets(int userMemory, int numOps, unsigned int seed) {
+    int budgets[] = {0, 16, 64, 256, 1024};
+    BudgetRun runs[5];
+
+    // STEP 1: Same requests with each budget
+    for (int b = 0; b < 5; b++) {
+        runs[b] = runBudgetWorkload(userMemory, budgets[b], numOps, seed);
+    }
+
+    // STEP 2: One table
+    printf("\n%d random steps over %d KB, First Fit:\n", numOps, userMemory);
+    printf("Budget KB  Placed  Avg frag %%  KB moved  Max KB/step  Pts per MB moved\n");
+    for (int b = 0; b < 5; b++) {
+        if (budgets[b] == 0) {
+            printf("%-10s %-7d %-11.2f %-9ld %-12d -\n", "off", runs[b].placed,
+                   runs[b].averageFragmentation, runs[b].kbMoved, runs[b].maxStepKB);
+        } else {
+            printf("%-10d %-7d %-11.2f %-9ld %-12d %.3f\n", budgets[b], runs[b].placed,
+                   runs[b].averageFragmentation, runs[b].kbMoved, runs[b].maxStepKB,
+                   runs[b].removedPerMB);
+        }
+    }
+}
+
+
+/*
+================================================================================
+END OF FILE: defrag.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableDefragmenter() / disableDefragmenter() - Budget and trigger
+2. defragStep() - Slide processes down until the budget is spent
+3. defragOnOperation() / defragAdvanceClock() - Per operation / per tick
+4. displayDefragStats() - KB moved and fragmentation removed per MB
+5. compareDefragBudgets() - Same workload, several budgets
+================================================================================
+*/
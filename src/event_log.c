@@ -0,0 +1,382 @@
+/*
+================================================================================
+FILE: event_log.c
+PURPOSE: Implement the delta event log and keyframe replay
+DESCRIPTION:
+    - logEvent() appends 16-byte events while the allocator runs
+    - Every K events a keyframe (copy of the block list) is saved
+    - rebuildFromEventLog() seeks to the nearest keyframe and replays
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/memory_manager.h"
+#include "../include/event_log.h"
+#include "../include/address_index.h"
+
+
+/*
+================================================================================
+FUNCTION: growArray (internal helper)
+================================================================================
+PURPOSE: Make sure a growable array has room for 'needed' elements
+
+Doubles the capacity each time, so appending is cheap on average.
+Returns 1 on success, 0 if realloc failed (the old array is kept).
+*/
+
+static int growArray(void **array, int *capacity, int needed, size_t elemSize) {
+    if (needed <= *capacity) {
+        return 1;
+    }
+
+    int newCapacity = (*capacity > 0) ? *capacity : 64;
+    while (newCapacity < needed) {
+        newCapacity *= 2;
+    }
+
+    void *bigger = realloc(*array, (size_t)newCapacity * elemSize);
+    if (bigger == NULL) {
+        if (isVerbose()) {
+            printf("Error: Event log is out of memory!\n");
+        }
+        return 0;
+    }
+
+    *array = bigger;
+    *capacity = newCapacity;
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: saveKeyframe (internal helper)
+================================================================================
+PURPOSE: Copy the current block list into the log
+*/
+
+static void saveKeyframe(EventLog *log, MemoryManager *mm) {
+
+    // Count blocks so we grow the shared array only once
+    int count = 0;
+    MemoryBlock *current = mm->head;
+    while (current != NULL) {
+        count++;
+        current = current->next;
+    }
+
+    if (!growArray((void **)&log->keyframes, &log->keyframeCapacity,
+                   log->numKeyframes + 1, sizeof(Keyframe)) ||
+        !growArray((void **)&log->frameBlocks, &log->frameBlockCapacity,
+                   log->numFrameBlocks + count, sizeof(KeyframeBlock))) {
+        return;
+    }
+
+    Keyframe *frame = &log->keyframes[log->numKeyframes++];
+    frame->eventIndex = log->numEvents;
+    frame->firstBlock = log->numFrameBlocks;
+    frame->numBlocks = count;
+
+    // Copy each block: holes are stored with processID = -1
+    current = mm->head;
+    while (current != NULL) {
+        KeyframeBlock *saved = &log->frameBlocks[log->numFrameBlocks++];
+        saved->startAddress = current->startAddress;
+        saved->size = current->size;
+        saved->processID = current->isHole ? -1 : current->processID;
+        current = current->next;
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: initEventLog
+================================================================================
+*/
+
+void initEventLog(EventLog *log, int keyframeInterval) {
+    log->events = NULL;
+    log->numEvents = 0;
+    log->eventCapacity = 0;
+
+    log->keyframes = NULL;
+    log->numKeyframes = 0;
+    log->keyframeCapacity = 0;
+
+    log->frameBlocks = NULL;
+    log->numFrameBlocks = 0;
+    log->frameBlockCapacity = 0;
+
+    log->keyframeInterval = (keyframeInterval < 1) ? 1 : keyframeInterval;
+    log->totalMemory = 0;
+    log->osMemory = 0;
+}
+
+
+/*
+================================================================================
+FUNCTION: attachEventLog
+================================================================================
+*/
+
+void attachEventLog(MemoryManager *mm, EventLog *log) {
+    mm->eventLog = log;
+
+    if (log == NULL) {
+        return;
+    }
+
+    // Remember the layout and save keyframe 0 if this is a fresh log
+    log->totalMemory = mm->totalMemory;
+    log->osMemory = mm->osMemory;
+    if (log->numKeyframes == 0) {
+        saveKeyframe(log, mm);
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: logEvent
+================================================================================
+PURPOSE: Append one event, saving a keyframe first when one is due
+
+WHY "FIRST"?
+The caller has not changed the block list yet, so right now the list
+shows the state after exactly numEvents events - a perfect keyframe.
+*/
+
+void logEvent(MemoryManager *mm, int type, int addrA, int value, int processID) {
+    EventLog *log = mm->eventLog;
+
+    // Recording disabled → nothing to do
+    if (log == NULL) {
+        return;
+    }
+
+    // STEP 1: Keyframe every K events
+    Keyframe *last = &log->keyframes[log->numKeyframes - 1];
+    if (log->numEvents - last->eventIndex >= log->keyframeInterval) {
+        saveKeyframe(log, mm);
+    }
+
+    // STEP 2: Append the event
+    if (!growArray((void **)&log->events, &log->eventCapacity,
+                   log->numEvents + 1, sizeof(MemoryEvent))) {
+        return;
+    }
+
+    MemoryEvent *event = &log->events[log->numEvents++];
+    event->type = type;
+    event->addrA = addrA;
+    event->value = value;
+    event->processID = processID;
+}
+
+
+/*
+================================================================================
+FUNCTION: findBlockStartingAt (internal helper)
+================================================================================
+PURPOSE: Find the block that starts exactly at 'address' (NULL if none)
+
+rebuildFromEventLog() attaches an AddressIndex while it replays, so
+this is O(log n) per event instead of a walk from the head.
+*/
+
+static MemoryBlock *findBlockStartingAt(MemoryManager *mm, int address) {
+    MemoryBlock *block = findBlockAt(mm, address);
+    return (block != NULL && block->startAddress == address) ? block : NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: applyEvent (internal helper)
+================================================================================
+PURPOSE: Redo one recorded change on a rebuilt MemoryManager
+
+Each case calls the same block list step memory_manager.c used when
+the event was logged, so replaying all events gives back exactly the
+same list. (The rebuilt manager has no log, so nothing is re-recorded.)
+*/
+
+static int applyEvent(MemoryManager *mm, MemoryEvent *event) {
+    MemoryBlock *block = findBlockStartingAt(mm, event->addrA);
+    if (block == NULL) {
+        return 0;
+    }
+
+    switch (event->type) {
+        case EVENT_SPLIT:
+            // Cut the hole at 'value'
+            splitBlock(mm, block, event->value);
+            break;
+
+        case EVENT_MERGE:
+            // Swallow the next hole
+            if (block->next == NULL || block->next->startAddress != event->value) {
+                return 0;
+            }
+            mergeWithNext(mm, block);
+            break;
+
+        case EVENT_BIND:
+            bindBlock(mm, block, event->processID);
+            break;
+
+        case EVENT_RELEASE:
+            unbindBlock(mm, block);
+            break;
+
+        default:
+            return 0;
+    }
+
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: rebuildFromEventLog
+================================================================================
+*/
+
+int rebuildFromEventLog(EventLog *log, int eventIndex, MemoryManager *out) {
+
+    if (eventIndex < 0 || eventIndex > log->numEvents || log->numKeyframes == 0) {
+        return 0;
+    }
+
+    // STEP 1: Binary search for the last keyframe at or before eventIndex
+    int low = 0;
+    int high = log->numKeyframes - 1;
+    while (low < high) {
+        int mid = (low + high + 1) / 2;
+        if (log->keyframes[mid].eventIndex <= eventIndex) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    Keyframe *frame = &log->keyframes[low];
+
+    // STEP 2: Fresh manager with the recorded layout (no banner printed)
+    resetMemoryManager(out);
+    out->totalMemory = log->totalMemory;
+    out->osMemory = log->osMemory;
+    out->userMemory = log->totalMemory - log->osMemory;
+
+    // STEP 3: Copy the keyframe's blocks into a new linked list
+    // (holes are also chained into the hole list, already in order)
+    MemoryBlock *tail = NULL;
+    MemoryBlock *lastHole = NULL;
+    for (int i = 0; i < frame->numBlocks; i++) {
+        KeyframeBlock *saved = &log->frameBlocks[frame->firstBlock + i];
+        int isHole = (saved->processID == -1);
+        MemoryBlock *block = createBlock(isHole, saved->startAddress,
+                                         saved->startAddress + saved->size - 1,
+                                         saved->processID);
+        if (tail == NULL) {
+            out->head = block;
+        } else {
+            tail->next = block;
+            block->prev = tail;
+        }
+        tail = block;
+
+        if (isHole) {
+            if (lastHole == NULL) {
+                out->firstHole = block;
+            } else {
+                lastHole->nextHole = block;
+                block->prevHole = lastHole;
+            }
+            lastHole = block;
+            out->numHoles++;
+            out->freeMemory += saved->size;
+        } else {
+            out->numProcesses++;
+        }
+    }
+
+    // STEP 4: Re-apply the events recorded after the keyframe, finding
+    // each block through an address index (detached again before we
+    // return - it lives on this stack frame)
+    if (eventIndex == frame->eventIndex) {
+        return 1;
+    }
+    AddressIndex addresses;
+    enableAddressIndex(out, &addresses);
+
+    int ok = 1;
+    for (int i = frame->eventIndex; i < eventIndex && ok; i++) {
+        if (!applyEvent(out, &log->events[i])) {
+            if (isVerbose()) {
+                printf("Error: Event %d does not match the rebuilt memory!\n", i);
+            }
+            ok = 0;
+        }
+    }
+
+    disableAddressIndex(out);
+    return ok;
+}
+
+
+/*
+================================================================================
+FUNCTION: truncateEventLog
+================================================================================
+*/
+
+void truncateEventLog(EventLog *log, int eventIndex) {
+    if (eventIndex < 0 || eventIndex >= log->numEvents) {
+        return;
+    }
+
+    log->numEvents = eventIndex;
+
+    // Drop keyframes taken after the new end (keyframe 0 always stays)
+    while (log->numKeyframes > 1 &&
+           log->keyframes[log->numKeyframes - 1].eventIndex > eventIndex) {
+        log->numKeyframes--;
+    }
+
+    // Their blocks were at the end of the shared array
+    Keyframe *last = &log->keyframes[log->numKeyframes - 1];
+    log->numFrameBlocks = last->firstBlock + last->numBlocks;
+}
+
+
+/*
+================================================================================
+FUNCTION: freeEventLog
+================================================================================
+*/
+
+void freeEventLog(EventLog *log) {
+    free(log->events);
+    free(log->keyframes);
+    free(log->frameBlocks);
+    initEventLog(log, log->keyframeInterval);
+}
+
+
+/*
+================================================================================
+END OF FILE: event_log.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. initEventLog() / freeEventLog() - Set up and release a log
+2. attachEventLog() - Start recording a MemoryManager
+3. logEvent() - Append a delta (and a keyframe every K events)
+4. rebuildFromEventLog() - Seek to nearest keyframe and replay forward
+5. truncateEventLog() - Rewind the log after a timeline restore
+================================================================================
+*/
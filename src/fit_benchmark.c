@@ -0,0 +1,167 @@
+/*
+================================================================================
+FILE: fit_benchmark.c
+PURPOSE: Separate benchmark program for First / Best / Worst Fit
+DESCRIPTION:
+    - Fills memory with random processes, frees half of them (lots of
+      holes), then times a steady stream of "free one, allocate one"
+    - The hole list walk is what is measured: no hole tree is attached,
+      and a BlockIndex makes each free O(1) so it doesn't hide the walk
+    - Prints ns per operation and a checksum of every address handed
+      out: two builds that print the same checksum placed every process
+      in the same spot, so only their speed differs
+
+HOW TO RUN:
+    ./build/fit_benchmark > bench_output.txt
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/memory_manager.h"
+#include "../include/block_index.h"
+
+#define BENCH_OPERATIONS 100000
+#define BENCH_REPEATS 5
+#define BENCH_MAX_SIZE 200
+
+
+/*
+================================================================================
+STRUCTURE: BenchResult
+================================================================================
+*/
+
+typedef struct BenchResult {
+    double nsPerOp;         // Best of BENCH_REPEATS
+    int holes;              // Holes when the timed part started
+    long placed;
+    unsigned long checksum; // Mix of every address handed out
+} BenchResult;
+
+
+/*
+================================================================================
+FUNCTION: nextRandom (internal helper)
+================================================================================
+*/
+
+static unsigned int nextRandom(unsigned int *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+
+/*
+================================================================================
+FUNCTION: runOnce
+================================================================================
+PURPOSE: One fill + timed churn with 'algo'; the same seed gives the
+         same starting memory for every algorithm
+*/
+
+static BenchResult runOnce(int userMemory, AllocationAlgorithm algo, unsigned int seed) {
+    BenchResult result = {0.0, 0, 0, 0};
+    MemoryManager mm;
+    BlockIndex index;
+    int *live = (int *)malloc(sizeof(int) * (userMemory + BENCH_OPERATIONS));
+    int numLive = 0;
+    int nextPID = 1;
+    unsigned int state = seed;
+
+    if (live == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return result;
+    }
+    initializeMemory(&mm, 256 + userMemory, 256);
+    enableBlockIndex(&mm, &index);
+
+    // STEP 1: Fill memory (First Fit), then free every other process
+    while (1) {
+        int size = 1 + (int)(nextRandom(&state) % BENCH_MAX_SIZE);
+        if (size > mm.freeMemory || allocateMemory(&mm, nextPID, size, FIRST_FIT) == -1) {
+            break;
+        }
+        live[numLive++] = nextPID++;
+    }
+    int kept = 0;
+    for (int i = 0; i < numLive; i++) {
+        if (i % 2 == 0) {
+            deallocateMemory(&mm, live[i]);
+        } else {
+            live[kept++] = live[i];
+        }
+    }
+    numLive = kept;
+    result.holes = mm.numHoles;
+
+    // STEP 2: Timed churn - free a random process, allocate a new one
+    clock_t start = clock();
+    for (int op = 0; op < BENCH_OPERATIONS; op++) {
+        unsigned int r = nextRandom(&state);
+        if (numLive > 0) {
+            int i = (int)(r % (unsigned int)numLive);
+            deallocateMemory(&mm, live[i]);
+            live[i] = live[--numLive];
+        }
+
+        int size = 1 + (int)(nextRandom(&state) % BENCH_MAX_SIZE);
+        int address = (size <= mm.freeMemory) ? allocateMemory(&mm, nextPID, size, algo) : -1;
+        if (address != -1) {
+            live[numLive++] = nextPID;
+            result.placed++;
+        }
+        result.checksum = result.checksum * 31 + (unsigned long)(address + 1);
+        nextPID++;
+    }
+    result.nsPerOp = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_OPERATIONS;
+
+    freeMemoryManager(&mm);
+    free(live);
+    return result;
+}
+
+
+/*
+================================================================================
+FUNCTION: main
+================================================================================
+*/
+
+int main(void) {
+    const char *names[] = {"First Fit", "Best Fit", "Worst Fit"};
+    int memorySizes[] = {100000, 1000000};
+
+    setVerbose(0);
+    printf("Fit benchmark: %d free+allocate pairs, best of %d runs\n\n",
+           BENCH_OPERATIONS, BENCH_REPEATS);
+    printf("Algorithm  Memory KB  Holes   ns/op      Placed   Checksum\n");
+
+    for (int m = 0; m < 2; m++) {
+        for (int algo = FIRST_FIT; algo <= WORST_FIT; algo++) {
+            BenchResult best = runOnce(memorySizes[m], (AllocationAlgorithm)algo, 42);
+            for (int rep = 1; rep < BENCH_REPEATS; rep++) {
+                BenchResult run = runOnce(memorySizes[m], (AllocationAlgorithm)algo, 42);
+                if (run.nsPerOp < best.nsPerOp) {
+                    best = run;
+                }
+            }
+            printf("%-10s %-10d %-7d %-10.1f %-8ld %016lx\n", names[algo], memorySizes[m],
+                   best.holes, best.nsPerOp, best.placed, best.checksum);
+        }
+    }
+    return 0;
+}
+
+
+/*
+================================================================================
+END OF FILE: fit_benchmark.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. runOnce() - Fill, free half, time a steady free/allocate stream
+2. main() - Every algorithm on a small and a large memory, best of 5
+================================================================================
+*/
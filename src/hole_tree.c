@@ -0,0 +1,325 @@
+/*
+================================================================================
+FILE: hole_tree.c
+PURPOSE: Implement the address-ordered treap of holes with subtree maxima
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/hole_tree.h"
+
+
+/*
+================================================================================
+TREAP (internal helpers)
+================================================================================
+Every function returns the new root of the subtree it was given, so the
+caller just stores it back: node->treeLeft = insertNode(node->treeLeft, x)
+*/
+
+static int maxOf(MemoryBlock *node) {
+    return (node != NULL) ? node->subtreeMax : 0;
+}
+
+// Recompute a node's subtree maximum from itself and its children
+static void pull(MemoryBlock *node) {
+    int largest = node->size;
+    if (maxOf(node->treeLeft) > largest) {
+        largest = maxOf(node->treeLeft);
+    }
+    if (maxOf(node->treeRight) > largest) {
+        largest = maxOf(node->treeRight);
+    }
+    node->subtreeMax = largest;
+}
+
+/*
+      n            l
+     / \          / \
+    l   c   →    a   n
+   / \              / \
+  a   b            b   c
+*/
+static MemoryBlock *rotateRight(MemoryBlock *n) {
+    MemoryBlock *l = n->treeLeft;
+    n->treeLeft = l->treeRight;
+    l->treeRight = n;
+    pull(n);
+    pull(l);
+    return l;
+}
+
+static MemoryBlock *rotateLeft(MemoryBlock *n) {
+    MemoryBlock *r = n->treeRight;
+    n->treeRight = r->treeLeft;
+    r->treeLeft = n;
+    pull(n);
+    pull(r);
+    return r;
+}
+
+static MemoryBlock *insertNode(MemoryBlock *root, MemoryBlock *node) {
+    if (root == NULL) {
+        return node;
+    }
+
+    // Insert like a normal search tree, then rotate the new node up
+    // while its priority is higher than its parent's
+    if (node->startAddress < root->startAddress) {
+        root->treeLeft = insertNode(root->treeLeft, node);
+        if (root->treeLeft->treePriority > root->treePriority) {
+            return rotateRight(root);
+        }
+    } else {
+        root->treeRight = insertNode(root->treeRight, node);
+        if (root->treeRight->treePriority > root->treePriority) {
+            return rotateLeft(root);
+        }
+    }
+    pull(root);
+    return root;
+}
+
+// Join two treaps where every key in 'a' is below every key in 'b'
+static MemoryBlock *joinTrees(MemoryBlock *a, MemoryBlock *b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    if (a->treePriority > b->treePriority) {
+        a->treeRight = joinTrees(a->treeRight, b);
+        pull(a);
+        return a;
+    }
+    b->treeLeft = joinTrees(a, b->treeLeft);
+    pull(b);
+    return b;
+}
+
+static MemoryBlock *removeNode(MemoryBlock *root, MemoryBlock *node) {
+    if (root == node) {
+        return joinTrees(node->treeLeft, node->treeRight);
+    }
+    if (node->startAddress < root->startAddress) {
+        root->treeLeft = removeNode(root->treeLeft, node);
+    } else {
+        root->treeRight = removeNode(root->treeRight, node);
+    }
+    pull(root);
+    return root;
+}
+
+// Walk down to 'node' and fix the maxima on the way back up
+static void refreshPath(MemoryBlock *root, MemoryBlock *node) {
+    if (root != node) {
+        refreshPath((node->startAddress < root->startAddress) ? root->treeLeft : root->treeRight,
+                    node);
+    }
+    pull(root);
+}
+
+// xorshift - fast, and good enough for balancing
+static unsigned int nextPriority(HoleTree *tree) {
+    unsigned int x = tree->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    tree->seed = x;
+    return x;
+}
+
+
+/*
+================================================================================
+FUNCTION: enableHoleTree / disableHoleTree
+================================================================================
+*/
+
+int enableHoleTree(MemoryManager *mm, HoleTree *tree) {
+    tree->root = NULL;
+    tree->numNodes = 0;
+    tree->seed = 2463534242u;
+
+    mm->holeTree = tree;
+    for (MemoryBlock *hole = mm->firstHole; hole != NULL; hole = hole->nextHole) {
+        holeTreeInsert(mm, hole);
+    }
+    return 1;
+}
+
+void disableHoleTree(MemoryManager *mm) {
+    if (mm->holeTree == NULL) {
+        return;
+    }
+
+    // Nodes are the holes themselves - just clear their links
+    for (MemoryBlock *hole = mm->firstHole; hole != NULL; hole = hole->nextHole) {
+        hole->treeLeft = NULL;
+        hole->treeRight = NULL;
+    }
+    mm->holeTree->root = NULL;
+    mm->holeTree->numNodes = 0;
+    mm->holeTree = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: holeTreeFirstFit
+================================================================================
+PURPOSE: One path from the root to the lowest hole that fits
+
+At each node the lowest addresses are on the left, so:
+1. Something on the left fits → go left (it is lower than this node)
+2. Else this hole fits → it is the answer
+3. Else the answer must be on the right
+*/
+
+MemoryBlock *holeTreeFirstFit(MemoryManager *mm, int size) {
+    MemoryBlock *node = mm->holeTree->root;
+
+    if (maxOf(node) < size) {
+        return NULL;        // Not even the largest hole fits
+    }
+
+    while (node != NULL) {
+        if (maxOf(node->treeLeft) >= size) {
+            node = node->treeLeft;
+        } else if (node->size >= size) {
+            return node;
+        } else {
+            node = node->treeRight;
+        }
+    }
+    return NULL;
+}
+
+int holeTreeLargest(MemoryManager *mm) {
+    return maxOf(mm->holeTree->root);
+}
+
+MemoryBlock *holeTreeHoleBefore(MemoryManager *mm, int address) {
+    MemoryBlock *node = mm->holeTree->root;
+    MemoryBlock *found = NULL;
+
+    while (node != NULL) {
+        if (node->startAddress < address) {
+            found = node;               // A candidate - try for a higher one
+            node = node->treeRight;
+        } else {
+            node = node->treeLeft;
+        }
+    }
+    return found;
+}
+
+
+/*
+================================================================================
+UPDATES
+================================================================================
+*/
+
+void holeTreeInsert(MemoryManager *mm, MemoryBlock *hole) {
+    HoleTree *tree = mm->holeTree;
+    if (tree == NULL) {
+        return;
+    }
+
+    hole->treeLeft = NULL;
+    hole->treeRight = NULL;
+    hole->treePriority = nextPriority(tree);
+    hole->subtreeMax = hole->size;
+    tree->root = insertNode(tree->root, hole);
+    tree->numNodes++;
+}
+
+void holeTreeRemove(MemoryManager *mm, MemoryBlock *hole) {
+    HoleTree *tree = mm->holeTree;
+    if (tree == NULL) {
+        return;
+    }
+
+    tree->root = removeNode(tree->root, hole);
+    tree->numNodes--;
+    hole->treeLeft = NULL;
+    hole->treeRight = NULL;
+}
+
+void holeTreeResized(MemoryManager *mm, MemoryBlock *hole) {
+    if (mm->holeTree != NULL) {
+        refreshPath(mm->holeTree->root, hole);
+    }
+}
+
+
+#ifdef MM_DEBUG_CHECKS
+/*
+================================================================================
+FUNCTION: holeTreeCheck (debug builds only)
+================================================================================
+*/
+
+// Returns the number of nodes below 'node', or -1 if something is wrong
+static int checkSubtree(MemoryBlock *node, int low, int high) {
+    if (node == NULL) {
+        return 0;
+    }
+    if (!node->isHole || node->startAddress < low || node->startAddress >= high) {
+        return -1;
+    }
+
+    MemoryBlock *left = node->treeLeft;
+    MemoryBlock *right = node->treeRight;
+    if ((left != NULL && left->treePriority > node->treePriority) ||
+        (right != NULL && right->treePriority > node->treePriority)) {
+        return -1;
+    }
+
+    int leftCount = checkSubtree(left, low, node->startAddress);
+    int rightCount = checkSubtree(right, node->startAddress + 1, high);
+    if (leftCount < 0 || rightCount < 0) {
+        return -1;
+    }
+
+    int largest = node->size;
+    if (maxOf(left) > largest) {
+        largest = maxOf(left);
+    }
+    if (maxOf(right) > largest) {
+        largest = maxOf(right);
+    }
+    if (node->subtreeMax != largest) {
+        return -1;
+    }
+    return leftCount + rightCount + 1;
+}
+
+int holeTreeCheck(MemoryManager *mm) {
+    int count = checkSubtree(mm->holeTree->root, 0, mm->totalMemory);
+
+    if (count != mm->numHoles || count != mm->holeTree->numNodes) {
+        printf("Error: Hole tree is inconsistent!\n");
+        return 0;
+    }
+    return 1;
+}
+#endif
+
+
+/*
+================================================================================
+END OF FILE: hole_tree.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableHoleTree() / disableHoleTree() - Treap built inside the holes
+2. holeTreeFirstFit() - Lowest fitting hole along one root-to-leaf path
+3. holeTreeLargest() / holeTreeHoleBefore() - Largest hole, predecessor
+4. holeTreeInsert() / holeTreeRemove() / holeTreeResized() - Upkeep
+5. holeTreeCheck() - Full consistency check (MM_DEBUG_CHECKS only)
+================================================================================
+*/
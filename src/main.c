@@ -3,7 +3,7 @@
 FILE: main.c
 PURPOSE: Main program - Text-based memory allocation visualizer
 DESCRIPTION: 
-    - Interactive menu system
+    - Interactive menu system, or script mode for batch jobs (--script)
     - Demonstrates First Fit, Best Fit, Worst Fit algorithms
     - Text-based visualization (works on all systems)
     - Complete memory management simulation
@@ -14,7 +14,503 @@ DESCRIPTION:
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <limits.h>
 #include "../include/memory_manager.h"
+#include "../include/shared_view.h"
+#include "../include/batch_alloc.h"
+#include "../include/quick_lists.h"
+#include "../include/admission_queue.h"
+#include "../include/swap.h"
+#include "../include/paging.h"
+#include "../include/tlb.h"
+#include "../include/hole_tree.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/compact_blocks.h"
+#include "../include/usage_map.h"
+#include "../include/defrag.h"
+#include "../include/script.h"
+#include "../include/simulation.h"
+#include "../include/block_index.h"
+#include "../include/page_replacement.h"
+#include "../include/numa.h"
+
+// Page size used when paging is compared with the partition algorithms
+#define COMPARE_PAGE_SIZE 16
+
+// Workload of --simulate N: same seed → same run
+#define SIMULATE_SEED 42
+#define SIMULATE_MEAN_INTERARRIVAL 1.0
+#define SIMULATE_MEAN_DURATION 20.0     // ~20 processes of ~34 KB resident
+#define SIMULATE_MIN_SIZE 4
+#define SIMULATE_MAX_SIZE 64
+
+// Workload of --numa: same seed → same requests for every policy
+#define NUMA_WORKLOAD_OPS 2000
+#define NUMA_WORKLOAD_MAX_SIZE 64
+#define NUMA_WORKLOAD_SEED 42
+
+/*
+================================================================================
+STRUCTURE: CommandLine
+================================================================================
+PURPOSE: Settings from the command line (defaults = the classic menu)
+
+USAGE:
+memory_visualizer [--total KB] [--os KB] [--policy first|best|worst]
+                  [--script FILE] [--format text|ndjson|csv] [--bitmap UNIT]
+                  [--compact BLOCKS] [--swap lru|largest|fewest] [--simulate N]
+                  [--replay FILE --frames N [--replace lru|clock|second|arc]]
+                  [--numa KB,KB,... [--numa-policy local|nearest|interleave]]
+
+EXAMPLES:
+./build/memory_visualizer                              (menu, 1024 / 256 KB)
+./build/memory_visualizer --total 4096 --os 512        (menu, bigger memory)
+./build/memory_visualizer --script jobs.txt --policy best > results.txt
+./build/memory_visualizer --script - < jobs.txt        (script from stdin)
+./build/memory_visualizer --script jobs.txt --format ndjson | dashboard
+./build/memory_visualizer --script jobs.txt --bitmap 4   (4 KB bitmap units)
+./build/memory_visualizer --simulate 1000000 --compact 0  (16-byte blocks)
+./build/memory_visualizer --script jobs.txt --swap lru   (swap when full)
+./build/memory_visualizer --simulate 100000 --policy best   (event-driven run)
+./build/memory_visualizer --replay trace.bin --frames 4096  (every page policy)
+./build/memory_visualizer --numa 512,256 --numa-policy local  (two NUMA nodes)
+*/
+
+typedef struct CommandLine {
+    int totalMemory;
+    int osMemory;
+    AllocationAlgorithm policy;     // Script "alloc" default / simulation fit
+    const char *scriptPath;         // NULL = interactive menu
+    ScriptFormat format;            // How script / simulation results are written
+    int bitmapUnit;                 // Memory as a bitmap (0 = blocks)
+    int compactBlocks;              // Compact pool for N blocks (-1 = blocks)
+    int swapPolicy;                 // Swap policy (-1 = no swapping)
+    int simulateCount;              // Processes to simulate (0 = no simulation)
+    const char *replayPath;         // Page reference log to replay (NULL = none)
+    int frames;                     // Page frames for the replay
+    int replacePolicy;              // One replacement policy (-1 = compare all)
+    int numaSizes[MAX_NUMA_NODES];  // KB per NUMA node
+    int numaNodes;                  // 0 = no NUMA workload
+    int numaPolicy;                 // Fallback policy (-1 = not given: nearest)
+} CommandLine;
+
+void printUsage(const char *program) {
+    printf("Usage: %s [--total KB] [--os KB] [--policy first|best|worst] [--script FILE]\n"
+           "       [--format text|ndjson|csv] [--bitmap UNIT] [--compact BLOCKS]\n"
+           "       [--swap lru|largest|fewest] [--simulate N] [--replay FILE --frames N [--replace lru|clock|second|arc]]\n"
+           "       [--numa KB,KB,... [--numa-policy local|nearest|interleave]]\n", program);
+    printf("  --total KB      Total memory (default 1024)\n");
+    printf("  --os KB         Memory reserved for the OS (default 256)\n");
+    printf("  --policy NAME   Default fit for script \"alloc\" lines and --simulate\n"
+           "                  (default first)\n");
+    printf("  --script FILE   Run FILE without prompts (\"-\" = standard input)\n");
+    printf("  --format NAME   Script / simulation output: text, ndjson or csv\n"
+           "                  (default text)\n");
+    printf("  --bitmap UNIT   Script / simulation memory is a bitmap of UNIT KB units\n");
+    printf("  --compact N     Script / simulation blocks take 16 bytes each, in one pool\n"
+           "                  sized for N blocks (0 = grow as needed)\n");
+    printf("  --swap NAME     Swap processes out when nothing fits (script /\n"
+           "                  simulation): lru, largest or fewest (default off)\n");
+    printf("  --simulate N    Simulate N random processes arriving and leaving,\n"
+           "                  then print the statistics (--format streams every event)\n");
+    printf("  --replay FILE   Replay a page reference log (32-bit page numbers) under\n"
+           "                  every replacement policy and compare the faults\n");
+    printf("  --frames N      Page frames for --replay\n");
+    printf("  --replace NAME  Replay under one policy only, streaming the file:\n"
+           "                  lru, clock, second or arc\n");
+    printf("  --numa KB,...   Run a random workload on NUMA nodes of these sizes (after\n"
+           "                  --os KB) and print remote allocations and fragmentation\n");
+    printf("  --numa-policy   When the preferred node is full: local, nearest\n"
+           "                  (default) or interleave\n");
+    printf("See include/script.h for the script commands and output format.\n");
+}
+
+/*
+FUNCTION: parseNumber
+PURPOSE: Read a whole decimal number: "4096" is fine; "abc", "4k", ""
+         and values that do not fit in an int are rejected
+RETURNS: 1 with *value set, or 0 (after printing why)
+*/
+int parseNumber(const char *option, const char *text, int *value) {
+    char *end;
+    errno = 0;
+    long number = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE ||
+        number < INT_MIN || number > INT_MAX) {
+        printf("Error: %s needs a whole number, not '%s'!\n", option, text);
+        return 0;
+    }
+    *value = (int)number;
+    return 1;
+}
+
+/*
+FUNCTION: parseNodeSizes
+PURPOSE: "512,256" → sizes {512, 256}, *count = 2 (1 to MAX_NUMA_NODES
+         sizes of at least 1 KB)
+RETURNS: 1, or 0 (after printing why)
+*/
+int parseNodeSizes(const char *text, int sizes[], int *count) {
+    char buffer[128];
+    *count = 0;
+
+    if (strlen(text) >= sizeof(buffer)) {
+        printf("Error: --numa list is too long!\n");
+        return 0;
+    }
+    strcpy(buffer, text);
+
+    // Empty pieces ("512,,256", "512,") are errors too, so no strtok
+    char *piece = buffer;
+    while (1) {
+        char *comma = strchr(piece, ',');
+        if (comma != NULL) {
+            *comma = '\0';
+        }
+        if (*count == MAX_NUMA_NODES) {
+            printf("Error: --numa takes at most %d nodes!\n", MAX_NUMA_NODES);
+            return 0;
+        }
+        if (!parseNumber("--numa", piece, &sizes[*count])) {
+            return 0;
+        }
+        if (sizes[*count] <= 0) {
+            printf("Error: --numa node sizes must be at least 1 KB!\n");
+            return 0;
+        }
+        (*count)++;
+        if (comma == NULL) {
+            return 1;
+        }
+        piece = comma + 1;
+    }
+}
+
+/*
+FUNCTION: parseCommandLine
+RETURNS: 1 if the arguments are valid, 0 (after printing why) if not
+*/
+int parseCommandLine(int argc, char *argv[], CommandLine *cl) {
+    cl->totalMemory = 1024;
+    cl->osMemory = 256;
+    cl->policy = FIRST_FIT;
+    cl->scriptPath = NULL;
+    cl->format = SCRIPT_TEXT;
+    cl->bitmapUnit = 0;
+    cl->compactBlocks = -1;
+    cl->swapPolicy = -1;
+    cl->simulateCount = 0;
+    cl->replayPath = NULL;
+    cl->frames = 0;
+    cl->replacePolicy = -1;
+    cl->numaNodes = 0;
+    cl->numaPolicy = -1;
+
+    for (int i = 1; i < argc; i++) {
+        // Every option takes exactly one value
+        if (i + 1 >= argc) {
+            printf("Error: Missing value for %s!\n", argv[i]);
+            return 0;
+        }
+        const char *value = argv[++i];
+
+        if (strcmp(argv[i - 1], "--total") == 0) {
+            if (!parseNumber("--total", value, &cl->totalMemory)) {
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--os") == 0) {
+            if (!parseNumber("--os", value, &cl->osMemory)) {
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--policy") == 0) {
+            if (parsePolicy(value) == -1) {
+                printf("Error: Unknown policy '%s'!\n", value);
+                return 0;
+            }
+            cl->policy = (AllocationAlgorithm)parsePolicy(value);
+        } else if (strcmp(argv[i - 1], "--script") == 0) {
+            cl->scriptPath = value;
+        } else if (strcmp(argv[i - 1], "--format") == 0) {
+            if (parseFormat(value) == -1) {
+                printf("Error: Unknown format '%s'!\n", value);
+                return 0;
+            }
+            cl->format = (ScriptFormat)parseFormat(value);
+        } else if (strcmp(argv[i - 1], "--bitmap") == 0) {
+            if (!parseNumber("--bitmap", value, &cl->bitmapUnit)) {
+                return 0;
+            }
+            if (cl->bitmapUnit <= 0) {
+                printf("Error: --bitmap needs a unit of at least 1 KB!\n");
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--compact") == 0) {
+            if (!parseNumber("--compact", value, &cl->compactBlocks)) {
+                return 0;
+            }
+            if (cl->compactBlocks < 0) {
+                printf("Error: --compact needs a block count of 0 or more!\n");
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--swap") == 0) {
+            if (parseSwapPolicy(value) == -1) {
+                printf("Error: Unknown swap policy '%s'!\n", value);
+                return 0;
+            }
+            cl->swapPolicy = parseSwapPolicy(value);
+        } else if (strcmp(argv[i - 1], "--simulate") == 0) {
+            if (!parseNumber("--simulate", value, &cl->simulateCount)) {
+                return 0;
+            }
+            if (cl->simulateCount <= 0) {
+                printf("Error: --simulate needs at least 1 process!\n");
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--replay") == 0) {
+            cl->replayPath = value;
+        } else if (strcmp(argv[i - 1], "--frames") == 0) {
+            if (!parseNumber("--frames", value, &cl->frames)) {
+                return 0;
+            }
+            if (cl->frames <= 0) {
+                printf("Error: --frames needs at least 1 frame!\n");
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--replace") == 0) {
+            if (parseReplacementPolicy(value) == -1) {
+                printf("Error: Unknown replacement policy '%s'!\n", value);
+                return 0;
+            }
+            cl->replacePolicy = parseReplacementPolicy(value);
+        } else if (strcmp(argv[i - 1], "--numa") == 0) {
+            if (!parseNodeSizes(value, cl->numaSizes, &cl->numaNodes)) {
+                return 0;
+            }
+        } else if (strcmp(argv[i - 1], "--numa-policy") == 0) {
+            if (parseNumaPolicy(value) == -1) {
+                printf("Error: Unknown NUMA policy '%s'!\n", value);
+                return 0;
+            }
+            cl->numaPolicy = parseNumaPolicy(value);
+        } else {
+            printf("Error: Unknown option %s!\n", argv[i - 1]);
+            return 0;
+        }
+    }
+
+    if (cl->osMemory < 0 || cl->totalMemory <= cl->osMemory) {
+        printf("Error: Need 0 <= OS memory < total memory!\n");
+        return 0;
+    }
+    if (cl->swapPolicy != -1 && cl->bitmapUnit > 0) {
+        printf("Error: --swap needs the block list - it cannot be used with --bitmap!\n");
+        return 0;
+    }
+    if (cl->swapPolicy != -1 && cl->compactBlocks != -1) {
+        printf("Error: --swap needs the block list - it cannot be used with --compact!\n");
+        return 0;
+    }
+    if (cl->bitmapUnit > 0 && cl->compactBlocks != -1) {
+        printf("Error: Use only one of --bitmap and --compact!\n");
+        return 0;
+    }
+    if ((cl->scriptPath != NULL) + (cl->simulateCount > 0) + (cl->replayPath != NULL) +
+        (cl->numaNodes > 0) > 1) {
+        printf("Error: Use only one of --script, --simulate, --replay and --numa!\n");
+        return 0;
+    }
+    if (cl->replayPath != NULL && cl->frames == 0) {
+        printf("Error: --replay needs --frames N!\n");
+        return 0;
+    }
+    if (cl->replayPath == NULL && (cl->frames > 0 || cl->replacePolicy != -1)) {
+        printf("Error: --frames and --replace only apply to --replay!\n");
+        return 0;
+    }
+    if (cl->numaNodes == 0 && cl->numaPolicy != -1) {
+        printf("Error: --numa-policy only applies to --numa!\n");
+        return 0;
+    }
+    return 1;
+}
+
+/*
+FUNCTION: runScriptFile
+RETURNS: Exit code - 0 all lines understood, 1 some were not, 2 no file
+*/
+int runScriptFile(CommandLine *cl) {
+    FILE *in = stdin;
+    ScriptStats stats;
+
+    if (strcmp(cl->scriptPath, "-") != 0) {
+        in = fopen(cl->scriptPath, "r");
+        if (in == NULL) {
+            fprintf(stderr, "Error: Cannot open script %s!\n", cl->scriptPath);
+            return 2;
+        }
+    }
+
+    // MAV_DEFRAG works here as in the menu (the menu reads it itself)
+    const char *defragSetting = getenv("MAV_DEFRAG");
+    int defragBudget = (defragSetting != NULL && atoi(defragSetting) > 0) ? atoi(defragSetting) : 0;
+
+    int ok = runScript(in, stdout, cl->totalMemory, cl->osMemory, cl->bitmapUnit,
+                       cl->compactBlocks, cl->swapPolicy, defragBudget, cl->policy, cl->format, &stats);
+    if (in != stdin) {
+        fclose(in);
+    }
+    return ok ? 0 : 1;
+}
+
+/*
+FUNCTION: runSimulationMode
+PURPOSE: --simulate N - one reproducible random workload, no menu. With
+         --format ndjson / csv every arrival and departure is a record
+         and the statistics come last as a "summary" record
+RETURNS: Exit code - 0 done, 1 out of memory
+*/
+int runSimulationMode(CommandLine *cl) {
+    MemoryManager mm;
+    BlockIndex index;
+    HoleTree holes;
+    BitmapBackend bitmap;
+    CompactPool compact;
+    SwapSpace swapSpace;
+    Simulation sim;
+    StreamWriter stream;
+    int n = cl->simulateCount;
+
+    SimProcess *processes = (SimProcess *)malloc(sizeof(SimProcess) * n);
+    if (processes == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed!\n");
+        return 1;
+    }
+
+    // STEP 1: Quiet memory; the indexes keep sampling and First Fit fast
+    setVerbose(0);
+    initializeMemory(&mm, cl->totalMemory, cl->osMemory);
+    enableBlockIndex(&mm, &index);
+    enableHoleTree(&mm, &holes);
+    if (cl->bitmapUnit > 0) {
+        enableBitmapBackend(&mm, &bitmap, cl->bitmapUnit);
+    }
+    if (cl->compactBlocks != -1 &&
+        !enableCompactBackend(&mm, &compact, (unsigned int)cl->compactBlocks)) {
+        freeMemoryManager(&mm);
+        free(processes);
+        return 1;
+    }
+    if (cl->swapPolicy != -1) {
+        enableSwapping(&mm, &swapSpace, (SwapPolicy)cl->swapPolicy);
+    }
+
+    // STEP 2: The workload and the engine
+    generateWorkload(processes, n, SIMULATE_SEED, SIMULATE_MEAN_INTERARRIVAL,
+                     SIMULATE_MEAN_DURATION, SIMULATE_MIN_SIZE, SIMULATE_MAX_SIZE);
+    if (!initSimulation(&sim, &mm, processes, n, cl->policy)) {
+        freeMemoryManager(&mm);
+        free(processes);
+        return 1;
+    }
+    if (cl->format != SCRIPT_TEXT) {
+        if (!openStream(&stream, stdout, (cl->format == SCRIPT_CSV) ? STREAM_CSV : STREAM_NDJSON)) {
+            freeSimulation(&sim);
+            freeMemoryManager(&mm);
+            free(processes);
+            return 1;
+        }
+        sim.stream = &stream;
+    }
+
+    // STEP 3: Until every process has come and gone
+    runSimulation(&sim, -1);
+
+    // STEP 4: Statistics (the rate depends on the machine, the rest does not)
+    if (sim.stream != NULL) {
+        char summary[160];
+        double average = (sim.fragmentationSamples > 0) ?
+                         sim.fragmentationSum / sim.fragmentationSamples : 0.0;
+        snprintf(summary, sizeof(summary),
+                 "events=%ld allocated=%ld rejected=%ld average_fragmentation=%.2f",
+                 sim.eventsProcessed, sim.allocated, sim.rejected, average);
+        streamNote(sim.stream, "summary", sim.eventsProcessed, summary);
+        closeStream(sim.stream);
+    } else {
+        printf("Simulated %d processes (%s, %d KB user memory, seed %d)\n",
+               n, policyName(cl->policy), mm.userMemory, SIMULATE_SEED);
+        displaySimulationStats(&sim);
+        if (mm.swapSpace != NULL) {
+            displaySwapStats(&mm);
+        }
+    }
+
+    freeSimulation(&sim);
+    freeMemoryManager(&mm);
+    free(processes);
+    return 0;
+}
+
+/*
+FUNCTION: runReplayMode
+PURPOSE: --replay FILE --frames N - page faults of a reference log. All
+         policies need the log in memory (one replay each); with
+         --replace only that policy runs, streaming the file in chunks
+RETURNS: Exit code - 0 done, 1 out of memory, 2 file not readable
+*/
+int runReplayMode(CommandLine *cl) {
+
+    // One policy: memory use does not depend on the file size
+    if (cl->replacePolicy != -1) {
+        ReplacementSim rs;
+        if (!initReplacement(&rs, (ReplacementPolicy)cl->replacePolicy, cl->frames)) {
+            return 1;
+        }
+        long long faults = replayReferenceFile(&rs, cl->replayPath);
+        if (faults != -1) {
+            displayReplacementStats(&rs);
+        }
+        freeReplacement(&rs);
+        return (faults == -1) ? 2 : 0;
+    }
+
+    // Every policy on the same references
+    long long n;
+    unsigned int *pages = loadReferenceFile(cl->replayPath, &n);
+    if (pages == NULL) {
+        return 2;
+    }
+    printf("%lld references from %s, %d frames:\n", n, cl->replayPath, cl->frames);
+    compareReplacementPolicies(pages, n, cl->frames);
+    free(pages);
+    return 0;
+}
+
+/*
+FUNCTION: runNumaMode
+PURPOSE: --numa KB,KB,... - one node per size after --os KB (10 local /
+         20 remote), the same random workload, then the per-node table
+RETURNS: Exit code - 0 done, 1 nodes could not be created
+*/
+int runNumaMode(CommandLine *cl) {
+    NumaSystem ns;
+    NumaPolicy policy = (cl->numaPolicy != -1) ? (NumaPolicy)cl->numaPolicy : NUMA_NEAREST;
+
+    setVerbose(0);
+    if (!initNuma(&ns, cl->numaSizes, cl->numaNodes, cl->osMemory, NULL, policy)) {
+        return 1;
+    }
+
+    long placed = runNumaWorkload(&ns, NUMA_WORKLOAD_OPS, NUMA_WORKLOAD_MAX_SIZE,
+                                  NUMA_WORKLOAD_SEED, cl->policy);
+    printf("%d steps of 1-%d KB (%s, seed %d), CPUs on every node in turn: %ld placed\n",
+           NUMA_WORKLOAD_OPS, NUMA_WORKLOAD_MAX_SIZE, policyName(cl->policy),
+           NUMA_WORKLOAD_SEED, placed);
+    displayNumaStats(&ns);
+    freeNuma(&ns);
+    return 0;
+}
+
 
 /*
 ================================================================================
@@ -87,8 +583,15 @@ Memory Visualization:
 0   256 356 456      656  1023
 
 Legend: [Process] [==Hole==]
+
+With a UsageMap attached, a to-scale bar of all memory follows. Past
+MAX_DRAWN_BLOCKS blocks only that bar is drawn (it costs the same for
+ten blocks or a million).
 */
 
+#define MAX_DRAWN_BLOCKS 40
+#define USAGE_BAR_COLUMNS 64
+
 void drawMemoryVisualization(MemoryManager *mm) {
     
     printf("\n");
@@ -96,6 +599,16 @@ void drawMemoryVisualization(MemoryManager *mm) {
     printf("│              MEMORY VISUALIZATION                       │\n");
     printf("└─────────────────────────────────────────────────────────┘\n");
     
+    // To scale: OS + user memory, one column per 1/64 of the addresses
+    if (mm->usageMap != NULL) {
+        drawUsageBar(mm->usageMap, 0, mm->totalMemory, USAGE_BAR_COLUMNS);
+    }
+    
+    // The bitmap backend has no blocks, and too many blocks flood the screen
+    if (mm->bitmap != NULL || mm->numProcesses + mm->numHoles > MAX_DRAWN_BLOCKS) {
+        return;
+    }
+    
     // Print memory blocks as ASCII bar
     printf("Memory: ");
     
@@ -129,6 +642,32 @@ void drawMemoryVisualization(MemoryManager *mm) {
 }
 
 
+/*
+================================================================================
+FUNCTION: requestMemory
+================================================================================
+PURPOSE: Allocate, or join the admission queue if one is enabled
+
+RETURNS: Start address, -1 if the request failed, or WAITING if it is
+         now waiting in the admission queue for space to be freed
+*/
+
+#define WAITING -2
+
+int requestMemory(MemoryManager *mm, int processID, int size,
+                  AllocationAlgorithm algo) {
+    AdmissionQueue *queue = mm->admissionQueue;
+    int waitingBefore = (queue != NULL) ? queue->numPending : 0;
+    
+    int result = submitRequest(mm, processID, size, 0, algo);
+    
+    if (result == -1 && queue != NULL && queue->numPending > waitingBefore) {
+        return WAITING;
+    }
+    return result;
+}
+
+
 /*
 ================================================================================
 FUNCTION: compareAlgorithms
@@ -137,7 +676,7 @@ PURPOSE: Run all three algorithms with same test data and compare results
 
 WHAT IT DOES:
 1. Creates identical test scenarios
-2. Runs First Fit, Best Fit, Worst Fit
+2. Runs First Fit, Best Fit, Worst Fit, then paging
 3. Shows fragmentation for each
 4. Displays comparison table
 */
@@ -155,6 +694,8 @@ void compareAlgorithms(MemoryManager *mm) {
     
     // Test scenario: 5 processes of different sizes
     int testSizes[] = {100, 200, 150, 50, 300};
+    int testPIDs[] = {1, 2, 3, 4, 5};
+    int addresses[5];           // Filled in by allocateBatch()
     int numTests = 5;
     
     printf("\nTest Scenario:\n");
@@ -169,8 +710,12 @@ void compareAlgorithms(MemoryManager *mm) {
     MemoryManager mm1;
     initializeMemory(&mm1, 1024, 256);
     
+    // Place all test processes with one batch call (same result as
+    // calling allocateMemory() for each one in order)
+    allocateBatch(&mm1, testPIDs, testSizes, numTests, FIRST_FIT, addresses);
+    
     for (int i = 0; i < numTests; i++) {
-        int result = allocateMemory(&mm1, i + 1, testSizes[i], FIRST_FIT);
+        int result = addresses[i];
         if (result != -1) {
             printf("✓ Process P%d (%d KB) allocated at address %d\n", 
                    i + 1, testSizes[i], result);
@@ -197,8 +742,12 @@ void compareAlgorithms(MemoryManager *mm) {
     MemoryManager mm2;
     initializeMemory(&mm2, 1024, 256);
     
+    // Place all test processes with one batch call (same result as
+    // calling allocateMemory() for each one in order)
+    allocateBatch(&mm2, testPIDs, testSizes, numTests, BEST_FIT, addresses);
+    
     for (int i = 0; i < numTests; i++) {
-        int result = allocateMemory(&mm2, i + 1, testSizes[i], BEST_FIT);
+        int result = addresses[i];
         if (result != -1) {
             printf("✓ Process P%d (%d KB) allocated at address %d\n", 
                    i + 1, testSizes[i], result);
@@ -225,8 +774,12 @@ void compareAlgorithms(MemoryManager *mm) {
     MemoryManager mm3;
     initializeMemory(&mm3, 1024, 256);
     
+    // Place all test processes with one batch call (same result as
+    // calling allocateMemory() for each one in order)
+    allocateBatch(&mm3, testPIDs, testSizes, numTests, WORST_FIT, addresses);
+    
     for (int i = 0; i < numTests; i++) {
-        int result = allocateMemory(&mm3, i + 1, testSizes[i], WORST_FIT);
+        int result = addresses[i];
         if (result != -1) {
             printf("✓ Process P%d (%d KB) allocated at address %d\n", 
                    i + 1, testSizes[i], result);
@@ -241,6 +794,57 @@ void compareAlgorithms(MemoryManager *mm) {
     float frag3 = calculateFragmentation(&mm3);
     printf("\nWorst Fit Fragmentation: %.2f%%\n", frag3);
     
+    printf("\nPress Enter to continue to Paging test...");
+    getchar();
+    
+    
+    // ============ TEST 4: PAGING ============
+    printf("\n\n═══════════════════════════════════════════════\n");
+    printf("        TEST 4: PAGING (%d KB PAGES)\n", COMPARE_PAGE_SIZE);
+    printf("═══════════════════════════════════════════════\n");
+    
+    // Same user region, but split into frames instead of partitions
+    MemoryManager mm4;
+    PagingSystem paging;
+    initializeMemory(&mm4, 1024, 256);
+    initPaging(&paging, &mm4, COMPARE_PAGE_SIZE);
+    
+    for (int i = 0; i < numTests; i++) {
+        int result = pagingAllocate(&paging, testPIDs[i], testSizes[i]);
+        if (result != -1) {
+            printf("✓ Process P%d (%d KB) allocated, page 0 at address %d\n", 
+                   i + 1, testSizes[i], result);
+        } else {
+            printf("✗ Process P%d (%d KB) allocation FAILED\n", 
+                   i + 1, testSizes[i]);
+        }
+    }
+    
+    displayPaging(&paging);
+    float frag4 = pagingFragmentation(&paging);
+    printf("\nPaging Fragmentation (internal): %.2f%%\n", frag4);
+    
+    // Bigger pages: fewer TLB misses and shorter walks, more waste.
+    // A small TLB (8 entries per page size) so the difference shows;
+    // P5 is left out because it does not fit with any page size.
+    TLBConfig tlbConfigs[] = {{4, 4, 2}, {16, 4, 2}, {64, 4, 2}, {256, 4, 2}};
+    WalkCostModel walkCost = DEFAULT_WALK_COST;
+    printf("\nPage size vs translation cost (100,000 accesses):\n");
+    compareHugePages(&mm4, testSizes, numTests - 1, tlbConfigs, 4,
+                     walkCost, 100000, 42);
+    
+    // The same fits over a bitmap instead of a block list
+    printf("\nBlock list vs bitmap (same placements, different bookkeeping):\n");
+    compareBackends(16384, 5000, 42);
+    
+    // The same fits over 16-byte pool entries instead of MemoryBlocks
+    printf("\nBlock list vs compact blocks (same placements, less metadata):\n");
+    compareLayouts(16384, 5000, 42);
+    
+    // Compaction a little at a time: how much each budget per operation buys
+    printf("\nIncremental compaction (KB moved per operation vs fragmentation):\n");
+    compareDefragBudgets(16384, 5000, 42);
+    
     
     // ============ COMPARISON SUMMARY ============
     printf("\n\n");
@@ -254,6 +858,7 @@ void compareAlgorithms(MemoryManager *mm) {
     printf("│  First Fit   │     %.2f%%     │   Fastest  │\n", frag1);
     printf("│  Best Fit    │     %.2f%%     │   Slowest  │\n", frag2);
     printf("│  Worst Fit   │     %.2f%%     │   Slow     │\n", frag3);
+    printf("│  Paging      │     %.2f%%     │   Fast     │\n", frag4);
     printf("└──────────────┴────────────────┴────────────┘\n");
     
     // Analysis
@@ -269,11 +874,15 @@ void compareAlgorithms(MemoryManager *mm) {
     printf("• First Fit is fastest (stops at first match)\n");
     printf("• Best Fit and Worst Fit are slower (check all holes)\n");
     printf("• Results vary depending on process arrival patterns\n");
+    printf("• Paging has no external fragmentation; its waste is the\n");
+    printf("  unused end of each process's last page (internal)\n");
     
     // Cleanup
     freeMemoryManager(&mm1);
     freeMemoryManager(&mm2);
     freeMemoryManager(&mm3);
+    freeMemoryManager(&mm4);
+    freePaging(&paging);
     
     printf("\nPress Enter to return to main menu...");
     getchar();
@@ -287,6 +896,7 @@ FUNCTION: main
 PURPOSE: Main program entry point
 
 WHAT IT DOES:
+0. Reads the command line; with --script, runs the script and exits
 1. Shows welcome message
 2. Initializes memory
 3. Shows menu in a loop
@@ -295,7 +905,30 @@ WHAT IT DOES:
 6. Continues until user exits
 */
 
-int main() {
+int main(int argc, char *argv[]) {
+    
+    // Command line first - script mode never shows the menu
+    CommandLine cl;
+    if (argc == 2 && (strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)) {
+        printUsage(argv[0]);
+        return 0;
+    }
+    if (!parseCommandLine(argc, argv, &cl)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+    if (cl.scriptPath != NULL) {
+        return runScriptFile(&cl);
+    }
+    if (cl.simulateCount > 0) {
+        return runSimulationMode(&cl);
+    }
+    if (cl.replayPath != NULL) {
+        return runReplayMode(&cl);
+    }
+    if (cl.numaNodes > 0) {
+        return runNumaMode(&cl);
+    }
     
     // Variables
     MemoryManager mm;           // Memory manager structure
@@ -305,13 +938,109 @@ int main() {
     int result;                 // Result of operations
     int nextProcessID = 1;      // Next available process ID
     char algoName[20] = "NONE"; // Current algorithm name
+    SharedView liveView;        // Optional mirror for shm_viewer
+    int hasLiveView = 0;
+    QuickLists quickLists;      // Optional deferred coalescing
+    int quickMaxSize = 0;       // 0 = merge holes right away (default)
+    AdmissionQueue admission;   // Optional queue for failed requests
+    int admissionPolicy = -1;   // -1 = failed requests are dropped
+    SwapSpace swapSpace;        // Optional backing store
+    int swapPolicy = -1;        // -1 = no swapping
+    HoleTree holeTree;          // Optional O(log n) First Fit
+    int useHoleTree = 0;
+    BitmapBackend bitmap;       // Optional bitmap instead of the block list
+    int bitmapUnit = 0;         // 0 = block list (default)
+    UsageMap usageMap;          // Used KB per bucket, for the to-scale bar
+    Defragmenter defrag;        // Optional incremental compaction
+    int defragBudget = 0;       // 0 = processes never move (default)
     
     // Display welcome banner
     printWelcome();
     
     // Initialize memory
-    // Total: 1024 KB, OS: 256 KB, User: 768 KB
-    initializeMemory(&mm, 1024, 256);
+    // Default: Total 1024 KB, OS 256 KB, User 768 KB (--total / --os)
+    initializeMemory(&mm, cl.totalMemory, cl.osMemory);
+    enableUsageMap(&mm, &usageMap, USAGE_MAP_MAX_BUCKETS);
+    
+    // Optional: mirror memory into shared memory for a live viewer
+    // Example: MAV_SHARED_VIEW=/mav_view ./build/memory_visualizer
+    const char *viewName = getenv("MAV_SHARED_VIEW");
+    if (viewName != NULL && createSharedView(&liveView, viewName, 65536, 1)) {
+        attachSharedView(&mm, &liveView);
+        hasLiveView = 1;
+        printf("Live view published at %s (run shm_viewer %s)\n",
+               viewName, viewName);
+    }
+    
+    // Optional: defer hole merging, reuse freed holes of the same size
+    // Example: MAV_QUICK_LISTS=256 ./build/memory_visualizer
+    const char *quickSetting = getenv("MAV_QUICK_LISTS");
+    if (quickSetting != NULL) {
+        quickMaxSize = atoi(quickSetting);
+    }
+    if (quickMaxSize > 0 && enableDeferredCoalescing(&mm, &quickLists, quickMaxSize, 64)) {
+        printf("Deferred coalescing on for sizes up to %d KB\n", quickMaxSize);
+    }
+    
+    // Optional: failed requests wait for space (fifo / smallest / priority)
+    // Example: MAV_ADMISSION=smallest ./build/memory_visualizer
+    const char *admissionSetting = getenv("MAV_ADMISSION");
+    if (admissionSetting != NULL) {
+        if (strcmp(admissionSetting, "fifo") == 0) {
+            admissionPolicy = ADMIT_FIFO;
+        } else if (strcmp(admissionSetting, "smallest") == 0) {
+            admissionPolicy = ADMIT_SMALLEST_FIRST;
+        } else if (strcmp(admissionSetting, "priority") == 0) {
+            admissionPolicy = ADMIT_PRIORITY;
+        }
+    }
+    if (admissionPolicy != -1) {
+        enableAdmissionQueue(&mm, &admission, (AdmissionPolicy)admissionPolicy);
+        printf("Failed requests will wait for free space (%s)\n", admissionSetting);
+    }
+    
+    // Optional: swap processes out when nothing fits (lru / largest / fewest)
+    // Example: MAV_SWAP=fewest ./build/memory_visualizer
+    const char *swapSetting = getenv("MAV_SWAP");
+    if (swapSetting != NULL) {
+        if (strcmp(swapSetting, "lru") == 0) {
+            swapPolicy = SWAP_LRU;
+        } else if (strcmp(swapSetting, "largest") == 0) {
+            swapPolicy = SWAP_LARGEST_FIRST;
+        } else if (strcmp(swapSetting, "fewest") == 0) {
+            swapPolicy = SWAP_FEWEST_BYTES;
+        }
+    }
+    if (swapPolicy != -1 && enableSwapping(&mm, &swapSpace, (SwapPolicy)swapPolicy)) {
+        printf("Processes will be swapped out when nothing fits (%s)\n", swapSetting);
+    }
+    
+    // Optional: find First Fit holes through a tree instead of a list walk
+    // Example: MAV_HOLE_TREE=1 ./build/memory_visualizer
+    const char *treeSetting = getenv("MAV_HOLE_TREE");
+    if (treeSetting != NULL && atoi(treeSetting) > 0) {
+        useHoleTree = 1;
+        enableHoleTree(&mm, &holeTree);
+        printf("First Fit searches a tree of holes\n");
+    }
+    
+    // Optional: keep memory as a bitmap of N KB units instead of blocks
+    // Example: MAV_BITMAP=1 ./build/memory_visualizer
+    const char *bitmapSetting = getenv("MAV_BITMAP");
+    if (bitmapSetting != NULL && atoi(bitmapSetting) > 0 &&
+        enableBitmapBackend(&mm, &bitmap, atoi(bitmapSetting))) {
+        bitmapUnit = atoi(bitmapSetting);
+        printf("Memory is tracked as a bitmap of %d KB units\n", bitmapUnit);
+    }
+    
+    // Optional: move up to N KB of processes down on every allocate/free
+    // Example: MAV_DEFRAG=64 ./build/memory_visualizer
+    const char *defragSetting = getenv("MAV_DEFRAG");
+    if (defragSetting != NULL && atoi(defragSetting) > 0 &&
+        enableDefragmenter(&mm, &defrag, atoi(defragSetting), 0)) {
+        defragBudget = atoi(defragSetting);
+        printf("Incremental compaction on: up to %d KB moved per operation\n", defragBudget);
+    }
     
     printf("Memory initialized successfully!\n");
     printf("Press Enter to start...");
@@ -324,11 +1053,16 @@ int main() {
         printMenu();
         
         // Get user choice
-        if (scanf("%d", &choice) != 1) {
+        int scanned = scanf("%d", &choice);
+        if (scanned == EOF) {
+            // Input ended (e.g. piped keystrokes ran out) - leave cleanly
+            choice = 9;
+        } else if (scanned != 1) {
             // Invalid input (not a number)
             printf("Invalid input! Please enter a number.\n");
             // Clear input buffer
-            while (getchar() != '\n');
+            int c;
+            while ((c = getchar()) != '\n' && c != EOF);
             continue;
         }
         
@@ -341,9 +1075,9 @@ int main() {
                 printf("Enter process size (KB): ");
                 scanf("%d", &size);
                 
-                result = allocateMemory(&mm, nextProcessID, size, FIRST_FIT);
+                result = requestMemory(&mm, nextProcessID, size, FIRST_FIT);
                 
-                if (result != -1) {
+                if (result >= 0) {
                     printf("\n✓ SUCCESS!\n");
                     printf("Process P%d (%d KB) allocated at address %d\n", 
                            nextProcessID, size, result);
@@ -354,6 +1088,10 @@ int main() {
                     // Show updated memory
                     displayMemory(&mm);
                     drawMemoryVisualization(&mm);
+                } else if (result == WAITING) {
+                    printf("\n⏳ P%d (%d KB) is waiting for free space\n",
+                           nextProcessID, size);
+                    nextProcessID++;
                 } else {
                     printf("\n✗ ALLOCATION FAILED!\n");
                     printf("Not enough contiguous memory available.\n");
@@ -368,9 +1106,9 @@ int main() {
                 printf("Enter process size (KB): ");
                 scanf("%d", &size);
                 
-                result = allocateMemory(&mm, nextProcessID, size, BEST_FIT);
+                result = requestMemory(&mm, nextProcessID, size, BEST_FIT);
                 
-                if (result != -1) {
+                if (result >= 0) {
                     printf("\n✓ SUCCESS!\n");
                     printf("Process P%d (%d KB) allocated at address %d\n", 
                            nextProcessID, size, result);
@@ -380,6 +1118,10 @@ int main() {
                     
                     displayMemory(&mm);
                     drawMemoryVisualization(&mm);
+                } else if (result == WAITING) {
+                    printf("\n⏳ P%d (%d KB) is waiting for free space\n",
+                           nextProcessID, size);
+                    nextProcessID++;
                 } else {
                     printf("\n✗ ALLOCATION FAILED!\n");
                     printf("Not enough contiguous memory available.\n");
@@ -394,9 +1136,9 @@ int main() {
                 printf("Enter process size (KB): ");
                 scanf("%d", &size);
                 
-                result = allocateMemory(&mm, nextProcessID, size, WORST_FIT);
+                result = requestMemory(&mm, nextProcessID, size, WORST_FIT);
                 
-                if (result != -1) {
+                if (result >= 0) {
                     printf("\n✓ SUCCESS!\n");
                     printf("Process P%d (%d KB) allocated at address %d\n", 
                            nextProcessID, size, result);
@@ -406,6 +1148,10 @@ int main() {
                     
                     displayMemory(&mm);
                     drawMemoryVisualization(&mm);
+                } else if (result == WAITING) {
+                    printf("\n⏳ P%d (%d KB) is waiting for free space\n",
+                           nextProcessID, size);
+                    nextProcessID++;
                 } else {
                     printf("\n✗ ALLOCATION FAILED!\n");
                     printf("Not enough contiguous memory available.\n");
@@ -420,8 +1166,11 @@ int main() {
                 
                 // Show current processes
                 printf("Current processes in memory:\n");
-                MemoryBlock *current = mm.head;
+                MemoryBlock *current = (mm.bitmap != NULL) ? NULL : mm.head;
                 int hasProcesses = 0;
+                if (mm.bitmap != NULL) {
+                    hasProcesses = listBitmapProcesses(&mm) > 0;
+                }
                 while (current != NULL) {
                     if (!current->isHole) {
                         printf("  P%d (%d KB at address %d)\n", 
@@ -440,15 +1189,24 @@ int main() {
                 printf("\nEnter process ID to deallocate: ");
                 scanf("%d", &processID);
                 
+                int admittedBefore = (mm.admissionQueue != NULL) ?
+                                     mm.admissionQueue->numAdmitted : 0;
                 result = deallocateMemory(&mm, processID);
                 
                 if (result) {
                     printf("\n✓ SUCCESS!\n");
                     printf("Process P%d has been deallocated\n", processID);
                     printf("Memory freed and holes merged (if adjacent)\n");
+                    if (mm.admissionQueue != NULL &&
+                        mm.admissionQueue->numAdmitted > admittedBefore) {
+                        printf("Waiting processes admitted: %d\n",
+                               mm.admissionQueue->numAdmitted - admittedBefore);
+                    }
                     
                     displayMemory(&mm);
                     drawMemoryVisualization(&mm);
+                } else if (cancelPendingRequest(&mm, processID)) {
+                    printf("\nP%d was still waiting - request cancelled.\n", processID);
                 } else {
                     printf("\n✗ DEALLOCATION FAILED!\n");
                     printf("Process P%d not found in memory.\n", processID);
@@ -493,6 +1251,23 @@ int main() {
                     } else {
                         printf("\n✗ High fragmentation - Consider compaction\n");
                     }
+                    
+                    if (mm.quickLists != NULL) {
+                        printf("\n");
+                        displayQuickListStats(&mm);
+                    }
+                    if (mm.admissionQueue != NULL) {
+                        printf("\n");
+                        displayAdmissionStats(&mm);
+                    }
+                    if (mm.swapSpace != NULL) {
+                        printf("\n");
+                        displaySwapStats(&mm);
+                    }
+                    if (mm.defragmenter != NULL) {
+                        printf("\n");
+                        displayDefragStats(&mm);
+                    }
                 }
                 break;
             
@@ -512,7 +1287,29 @@ int main() {
                 
                 if (confirm == 'y' || confirm == 'Y') {
                     freeMemoryManager(&mm);
-                    initializeMemory(&mm, 1024, 256);
+                    initializeMemory(&mm, cl.totalMemory, cl.osMemory);
+                    enableUsageMap(&mm, &usageMap, USAGE_MAP_MAX_BUCKETS);
+                    if (hasLiveView) {
+                        attachSharedView(&mm, &liveView);
+                    }
+                    if (quickMaxSize > 0) {
+                        enableDeferredCoalescing(&mm, &quickLists, quickMaxSize, 64);
+                    }
+                    if (admissionPolicy != -1) {
+                        enableAdmissionQueue(&mm, &admission, (AdmissionPolicy)admissionPolicy);
+                    }
+                    if (swapPolicy != -1) {
+                        enableSwapping(&mm, &swapSpace, (SwapPolicy)swapPolicy);
+                    }
+                    if (useHoleTree) {
+                        enableHoleTree(&mm, &holeTree);
+                    }
+                    if (bitmapUnit > 0) {
+                        enableBitmapBackend(&mm, &bitmap, bitmapUnit);
+                    }
+                    if (defragBudget > 0) {
+                        enableDefragmenter(&mm, &defrag, defragBudget, 0);
+                    }
                     nextProcessID = 1;
                     strcpy(algoName, "NONE");
                     printf("\n✓ Memory reset successfully!\n");
@@ -534,6 +1331,9 @@ int main() {
                 
                 // Cleanup
                 freeMemoryManager(&mm);
+                if (hasLiveView) {
+                    closeSharedView(&liveView);
+                }
                 
                 printf("Goodbye!\n\n");
                 return 0;
@@ -13,7 +13,52 @@ DESCRIPTION:
 // Include necessary headers
 #include <stdio.h>      // For printf, scanf
 #include <stdlib.h>     // For malloc, free
+#include <string.h>     // For memset
 #include "../include/memory_manager.h"
+#include "../include/event_log.h"
+#include "../include/shared_view.h"
+#include "../include/quick_lists.h"
+#include "../include/admission_queue.h"
+#include "../include/block_index.h"
+#include "../include/swap.h"
+#include "../include/segmentation.h"
+#include "../include/hole_tree.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/address_index.h"
+#include "../include/usage_map.h"
+#include "../include/defrag.h"
+#include "../include/compact_blocks.h"
+
+
+/*
+================================================================================
+MESSAGES
+================================================================================
+Banners and "Error: ..." lines are for people at the menu. Script mode
+(see script.h) turns them off so its output stays machine-readable.
+*/
+
+static int verboseMessages = 1;
+
+void setVerbose(int on) {
+    verboseMessages = on;
+}
+
+int isVerbose(void) {
+    return verboseMessages;
+}
+
+
+/*
+================================================================================
+FUNCTION: resetMemoryManager
+================================================================================
+PURPOSE: All fields zero / NULL (see memory_manager.h)
+*/
+
+void resetMemoryManager(MemoryManager *mm) {
+    memset(mm, 0, sizeof(MemoryManager));
+}
 
 
 /*
@@ -39,6 +84,12 @@ Starting a new neighborhood:
 
 void initializeMemory(MemoryManager *mm, int totalMem, int osMem) {
     
+    // No event log, shared mirror, quick lists, admission queue,
+    // indexes, swap space, segment tables, bitmap, compact pool or
+    // defragmenter
+    // until someone attaches one; nothing resized yet
+    resetMemoryManager(mm);
+    
     // STEP 1: Set basic memory sizes
     mm->totalMemory = totalMem;
     mm->osMemory = osMem;
@@ -66,13 +117,16 @@ void initializeMemory(MemoryManager *mm, int totalMem, int osMem) {
         totalMem - 1,         // endAddress = end of total memory
         -1                    // processID = -1 (it's a hole, no process)
     );
+    mm->firstHole = mm->head;     // It is also the whole hole list
     
     // STEP 7: Print confirmation message
-    printf("\n=== Memory Initialized ===\n");
-    printf("Total Memory: %d KB\n", mm->totalMemory);
-    printf("OS Memory: %d KB\n", mm->osMemory);
-    printf("User Memory: %d KB\n", mm->userMemory);
-    printf("==========================\n\n");
+    if (verboseMessages) {
+        printf("\n=== Memory Initialized ===\n");
+        printf("Total Memory: %d KB\n", mm->totalMemory);
+        printf("OS Memory: %d KB\n", mm->osMemory);
+        printf("User Memory: %d KB\n", mm->userMemory);
+        printf("==========================\n\n");
+    }
 }
 
 /*
@@ -97,6 +151,290 @@ head → [isHole:1, start:256, end:1023, size:768, pid:-1, next:NULL]
 */
 
 
+/*
+================================================================================
+BLOCK LIST HELPERS (shared)
+================================================================================
+Every change to the block list is one of four small steps:
+- splitBlock:    cut a hole in two
+- mergeWithNext: a hole swallows the hole right after it
+- bindBlock:     a hole becomes a process
+- unbindBlock:   a process becomes a hole
+Each step records its event, keeps the statistics right, and updates
+the hole list, quick lists and indexes (when those are switched on).
+All modules change memory only through these, so nothing gets out of sync.
+*/
+
+// Put 'hole' on the hole list right after 'before' (NULL = at the front)
+static void linkHole(MemoryManager *mm, MemoryBlock *before, MemoryBlock *hole) {
+    MemoryBlock *after = (before != NULL) ? before->nextHole : mm->firstHole;
+
+    hole->prevHole = before;
+    hole->nextHole = after;
+    if (before != NULL) {
+        before->nextHole = hole;
+    } else {
+        mm->firstHole = hole;
+    }
+    if (after != NULL) {
+        after->prevHole = hole;
+    }
+}
+
+static void unlinkHole(MemoryManager *mm, MemoryBlock *hole) {
+    if (hole->prevHole != NULL) {
+        hole->prevHole->nextHole = hole->nextHole;
+    } else {
+        mm->firstHole = hole->nextHole;
+    }
+    if (hole->nextHole != NULL) {
+        hole->nextHole->prevHole = hole->prevHole;
+    }
+    hole->prevHole = NULL;
+    hole->nextHole = NULL;
+}
+
+// The hole with the highest address below 'block' (NULL if none).
+// Walks outwards both ways and stops at the first hole on either side,
+// so a free next to a hole - the usual case - costs O(1)
+static MemoryBlock *holeBefore(MemoryManager *mm, MemoryBlock *block) {
+    if (mm->firstHole == NULL || mm->firstHole->startAddress > block->startAddress) {
+        return NULL;
+    }
+    if (mm->holeTree != NULL) {
+        return holeTreeHoleBefore(mm, block->startAddress);    // O(log n)
+    }
+
+    MemoryBlock *back = block->prev;
+    MemoryBlock *ahead = block->next;
+    while (back != NULL) {
+        if (back->isHole) {
+            return back;
+        }
+        if (ahead != NULL) {
+            if (ahead->isHole) {
+                return ahead->prevHole;     // No hole in between
+            }
+            ahead = ahead->next;
+        }
+        back = back->prev;
+    }
+    return NULL;
+}
+
+MemoryBlock *splitBlock(MemoryManager *mm, MemoryBlock *hole, int atAddress) {
+    
+    // A cached hole is about to change size - take it off its quick list
+    forgetQuickBlock(mm, hole);
+    
+    // Record the split before changing anything
+    logEvent(mm, EVENT_SPLIT, hole->startAddress, atAddress, -1);
+    
+    // CREATE new hole for the space from 'atAddress' to the end
+    MemoryBlock *rest = createBlock(1, atAddress, hole->endAddress, -1);
+    
+    // SHRINK the original hole so it ends just before 'atAddress'
+    hole->endAddress = atAddress - 1;
+    hole->size = hole->endAddress - hole->startAddress + 1;
+    
+    // INSERT new hole right after the shrunk block
+    rest->next = hole->next;
+    rest->prev = hole;
+    if (hole->next != NULL) {
+        hole->next->prev = rest;
+    }
+    hole->next = rest;
+    linkHole(mm, hole, rest);
+    
+    // One more hole
+    mm->numHoles++;
+    indexHoleChanged(mm, hole);
+    indexHoleChanged(mm, rest);
+    holeTreeResized(mm, hole);
+    holeTreeInsert(mm, rest);
+    addressIndexInsert(mm, rest);
+    
+    return rest;
+}
+
+void mergeWithNext(MemoryManager *mm, MemoryBlock *hole) {
+    MemoryBlock *nextHole = hole->next;
+    
+    forgetQuickBlock(mm, hole);
+    forgetQuickBlock(mm, nextHole);
+    logEvent(mm, EVENT_MERGE, hole->startAddress, nextHole->startAddress, -1);
+    indexHoleRemoved(mm, nextHole);
+    holeTreeRemove(mm, nextHole);
+    addressIndexRemove(mm, nextHole);
+    unlinkHole(mm, nextHole);
+    
+    // Extend the hole to include the next one
+    hole->endAddress = nextHole->endAddress;
+    hole->size = hole->endAddress - hole->startAddress + 1;
+    
+    // Remove next hole from list and free its memory
+    hole->next = nextHole->next;
+    if (nextHole->next != NULL) {
+        nextHole->next->prev = hole;
+    }
+    free(nextHole);
+    
+    // One less hole (merged two into one)
+    mm->numHoles--;
+    indexHoleChanged(mm, hole);
+    holeTreeResized(mm, hole);
+}
+
+void bindBlock(MemoryManager *mm, MemoryBlock *hole, int processID) {
+    
+    forgetQuickBlock(mm, hole);
+    logEvent(mm, EVENT_BIND, hole->startAddress, hole->size, processID);
+    indexHoleRemoved(mm, hole);
+    holeTreeRemove(mm, hole);
+    unlinkHole(mm, hole);
+    
+    hole->isHole = 0;               // No longer a hole
+    hole->processID = processID;    // Assign process ID
+    
+    // Update statistics
+    mm->numHoles--;                 // One less hole
+    mm->numProcesses++;             // One more process
+    mm->freeMemory -= hole->size;   // Less free memory
+    
+    indexProcessAdded(mm, hole);
+    usageMapUpdate(mm, hole->startAddress, hole->size, 1);
+}
+
+void unbindBlock(MemoryManager *mm, MemoryBlock *block) {
+    
+    logEvent(mm, EVENT_RELEASE, block->startAddress,
+             block->size, block->processID);
+    indexProcessRemoved(mm, block);
+    usageMapUpdate(mm, block->startAddress, block->size, -1);
+    
+    block->isHole = 1;           // Mark as hole
+    block->processID = -1;       // No process ID
+    block->segment = -1;         // Not part of a segmented process any more
+    linkHole(mm, holeBefore(mm, block), block);
+    
+    // Update statistics
+    mm->numProcesses--;
+    mm->numHoles++;                 // One more hole (for now)
+    mm->freeMemory += block->size;  // More free memory
+    
+    indexHoleChanged(mm, block);
+    holeTreeInsert(mm, block);
+}
+
+
+/*
+================================================================================
+FUNCTION: placeProcess (shared helper)
+================================================================================
+PURPOSE: Put a process into a hole that an algorithm has already chosen
+
+WHY A HELPER?
+First Fit, Best Fit and Worst Fit only differ in HOW they choose the hole.
+Once the hole is chosen, the work is identical:
+1. Exact fit → convert the entire hole to a process
+2. Bigger hole → split it (process + remaining hole)
+3. Update statistics
+Keeping this in one place means every change (for example, recording
+events for the timeline) is made once instead of three times.
+Other modules (batch allocation, etc.) call it too.
+*/
+
+int placeProcess(MemoryManager *mm, MemoryBlock *hole,
+                 int processID, int size) {
+    
+    // CASE 1: Exact fit (hole size equals process size)
+    // Example: Need 100 KB, hole is exactly 100 KB
+    // Nothing to cut - the whole hole goes to the process below
+    
+    // CASE 2: Hole is bigger than needed - must split it
+    // Example: Need 100 KB, hole is 200 KB
+    // If process uses 0-99, the new hole starts at 100
+    if (hole->size > size) {
+        splitBlock(mm, hole, hole->startAddress + size);
+    }
+    
+    // Now the block is exactly 'size' KB - hand it to the process
+    bindBlock(mm, hole, processID);
+    
+    return hole->startAddress;
+}
+
+
+/*
+================================================================================
+THE FIT KERNEL
+================================================================================
+PURPOSE: One hole-list search, written out once per algorithm
+
+First, Best and Worst Fit walk the hole list the same way. They only
+differ in two rules:
+
+             BETTER: is 'hole' better than 'chosen'?   DONE: stop now?
+First Fit    (never asked)                              always
+Best Fit     hole->size < chosen->size                  chosen is an exact fit
+Worst Fit    hole->size > chosen->size                  chosen is 'target' KB
+
+FIT_KERNEL pastes the two rules into the loop, so each algorithm gets its
+own plain loop - no switch or function pointer inside it - and whatever
+it picks goes to placeProcess() (the one place that splits and counts).
+BETTER is strict, so ties go to the lowest address. Stopping early
+changes nothing: Best Fit stops at an exact fit and Worst Fit at a hole
+of the largest size ('target', known in O(1) when a BlockIndex is
+attached) - no later hole can be strictly better.
+*/
+
+#define FIT_KERNEL(NAME, BETTER, DONE)                                      \
+static MemoryBlock *NAME(MemoryBlock *hole, int size, int target) {         \
+    MemoryBlock *chosen = NULL;                                             \
+    for (; hole != NULL; hole = hole->nextHole) {                           \
+        if (hole->size < size) {                                            \
+            continue;                                                       \
+        }                                                                   \
+        if (chosen == NULL || (BETTER)) {                                   \
+            chosen = hole;                                                  \
+            if (DONE) {                                                     \
+                break;                                                      \
+            }                                                               \
+        }                                                                   \
+    }                                                                       \
+    (void)target;                                                           \
+    return chosen;                                                          \
+}
+
+FIT_KERNEL(searchFirstFit, 0, 1)
+FIT_KERNEL(searchBestFit, hole->size < chosen->size, chosen->size == size)
+FIT_KERNEL(searchWorstFit, hole->size > chosen->size, chosen->size == target)
+
+// Commit: place the process in the chosen hole, or fail
+static int commitFit(MemoryManager *mm, MemoryBlock *hole, int processID, int size) {
+    return (hole != NULL) ? placeProcess(mm, hole, processID, size) : -1;
+}
+
+
+#ifdef MM_DEBUG_CHECKS
+/*
+DEBUG CHECK (-DMM_DEBUG_CHECKS): the tree must pick exactly the hole the
+hole list walk would pick. Any difference is printed, so a debug
+build run through the normal test cases doubles as a differential test.
+*/
+static void checkTreeFirstFit(MemoryManager *mm, int size, MemoryBlock *fromTree) {
+    MemoryBlock *fromList = searchFirstFit(mm->firstHole, size, 0);
+
+    if (fromTree != fromList) {
+        printf("Error: Hole tree chose %d, hole list chose %d for %d KB!\n",
+               fromTree ? fromTree->startAddress : -1,
+               fromList ? fromList->startAddress : -1, size);
+    }
+    holeTreeCheck(mm);
+}
+#endif
+
+
 /*
 ================================================================================
 FUNCTION: firstFit
@@ -104,8 +442,8 @@ FUNCTION: firstFit
 PURPOSE: Allocate memory using First Fit algorithm
 
 ALGORITHM EXPLANATION:
-1. Start from the beginning of memory (head of linked list)
-2. Look at each block one by one
+1. Start from the lowest hole (head of the hole list)
+2. Look at each hole one by one (processes are never visited)
 3. If you find a HOLE that is big enough → USE IT
 4. If hole is exactly the right size → convert entire hole to process
 5. If hole is bigger → split it (process + remaining hole)
@@ -119,85 +457,18 @@ SPEED: FASTEST (stops at first match)
 
 int firstFit(MemoryManager *mm, int processID, int size) {
     
-    // STEP 1: Start at the beginning of memory
-    // 'current' is a pointer that will "walk" through our linked list
-    MemoryBlock *current = mm->head;
-    
-    // STEP 2: Walk through the linked list looking for a suitable hole
-    // Loop continues while current is not NULL (not at end of list)
-    while (current != NULL) {
-        
-        // STEP 3: Check if this block is a hole AND big enough
-        // We need TWO conditions to be true:
-        //   1. current->isHole == 1 (it's free space)
-        //   2. current->size >= size (it's big enough)
-        if (current->isHole && current->size >= size) {
-            
-            // WE FOUND A SUITABLE HOLE! Now allocate it.
-            
-            // Save the starting address (we'll return this)
-            int startAddr = current->startAddress;
-            
-            // CASE 1: Exact fit (hole size equals process size)
-            // Example: Need 100 KB, hole is exactly 100 KB
-            if (current->size == size) {
-                
-                // Convert the entire hole to a process
-                current->isHole = 0;           // No longer a hole
-                current->processID = processID; // Assign process ID
-                
-                // Update statistics
-                mm->numHoles--;  // One less hole
-                // (numProcesses updated at end of function)
-            } 
-            // CASE 2: Hole is bigger than needed - must split it
-            // Example: Need 100 KB, hole is 200 KB
-            else {
-                
-                // Calculate where the new hole should start
-                // If process uses 0-99, new hole starts at 100
-                int newStart = current->startAddress + size;
-                
-                // Save the original end address of the hole
-                int oldEnd = current->endAddress;
-                
-                // MODIFY current block to become the process
-                current->endAddress = newStart - 1;  // Process ends before new hole
-                current->size = size;                 // Process size
-                current->isHole = 0;                  // It's a process now
-                current->processID = processID;       // Assign process ID
-                
-                // CREATE new hole for the remaining space
-                MemoryBlock *newHole = createBlock(
-                    1,              // isHole = 1
-                    newStart,       // starts after the process
-                    oldEnd,         // ends where old hole ended
-                    -1              // processID = -1 (it's a hole)
-                );
-                
-                // INSERT new hole into linked list
-                // Put it right after current block
-                newHole->next = current->next;  // New hole points to what current pointed to
-                current->next = newHole;         // Current now points to new hole
-                
-                // Note: numHoles stays same (replaced one hole with process + new hole)
-            }
-            
-            // STEP 4: Update statistics
-            mm->numProcesses++;         // One more process
-            mm->freeMemory -= size;     // Less free memory
-            
-            // STEP 5: Return starting address (SUCCESS!)
-            return startAddr;
-        }
-        
-        // STEP 6: This block didn't work, move to next block
-        current = current->next;
+    // FAST PATH: with a hole tree, one root-to-leaf walk finds the same hole
+    if (mm->holeTree != NULL) {
+        MemoryBlock *hole = holeTreeFirstFit(mm, size);
+#ifdef MM_DEBUG_CHECKS
+        checkTreeFirstFit(mm, size, hole);
+#endif
+        return commitFit(mm, hole, processID, size);
     }
     
-    // STEP 7: We went through entire list and found no suitable hole
-    // Return -1 to indicate FAILURE
-    return -1;
+    // Walk the hole list from the lowest hole; the first hole that is
+    // big enough wins (placeProcess() splits it if it is bigger)
+    return commitFit(mm, searchFirstFit(mm->firstHole, size, 0), processID, size);
 }
 
 /*
@@ -238,71 +509,14 @@ Finds the "best" hole - the one that wastes the least space.
 
 ADVANTAGE: Minimizes wasted space per allocation
 DISADVANTAGE: Creates many tiny unusable holes over time
-SPEED: SLOW (must check all holes)
+SPEED: SLOW (must check all holes, unless an exact fit turns up)
 */
 
 int bestFit(MemoryManager *mm, int processID, int size) {
     
-    // STEP 1: Initialize search variables
-    MemoryBlock *current = mm->head;     // Current block being checked
-    MemoryBlock *bestBlock = NULL;       // Best hole found so far
-    int minSize = mm->totalMemory + 1;   // Smallest suitable size found
-                                         // Start with impossible value
-    
-    // STEP 2: Search through ALL blocks to find smallest suitable hole
-    while (current != NULL) {
-        
-        // Check if this is a suitable hole
-        if (current->isHole && current->size >= size) {
-            
-            // Is this smaller than our current best?
-            if (current->size < minSize) {
-                minSize = current->size;      // Update minimum
-                bestBlock = current;          // This is new best
-            }
-        }
-        
-        // Move to next block
-        current = current->next;
-    }
-    
-    // STEP 3: Check if we found any suitable hole
-    if (bestBlock == NULL) {
-        return -1;  // No suitable hole found
-    }
-    
-    // STEP 4: We found the best hole - now allocate it
-    // (Same allocation logic as First Fit)
-    
-    int startAddr = bestBlock->startAddress;
-    
-    // Exact fit
-    if (bestBlock->size == size) {
-        bestBlock->isHole = 0;
-        bestBlock->processID = processID;
-        mm->numHoles--;
-    } 
-    // Split hole
-    else {
-        int newStart = bestBlock->startAddress + size;
-        int oldEnd = bestBlock->endAddress;
-        
-        bestBlock->endAddress = newStart - 1;
-        bestBlock->size = size;
-        bestBlock->isHole = 0;
-        bestBlock->processID = processID;
-        
-        // Create new hole for remaining space
-        MemoryBlock *newHole = createBlock(1, newStart, oldEnd, -1);
-        newHole->next = bestBlock->next;
-        bestBlock->next = newHole;
-    }
-    
-    // Update statistics
-    mm->numProcesses++;
-    mm->freeMemory -= size;
-    
-    return startAddr;
+    // Walk ALL holes, keeping the smallest one that is big enough
+    // (an exact fit ends the walk early - nothing can beat it)
+    return commitFit(mm, searchBestFit(mm->firstHole, size, 0), processID, size);
 }
 
 /*
@@ -352,64 +566,26 @@ SPEED: SLOW (must check all holes)
 
 int worstFit(MemoryManager *mm, int processID, int size) {
     
-    // STEP 1: Initialize search variables
-    MemoryBlock *current = mm->head;
-    MemoryBlock *worstBlock = NULL;   // Largest hole found
-    int maxSize = -1;                 // Largest suitable size found
-    
-    // STEP 2: Search through ALL blocks to find largest suitable hole
-    while (current != NULL) {
-        
-        // Check if this is a suitable hole
-        if (current->isHole && current->size >= size) {
-            
-            // Is this larger than our current worst?
-            if (current->size > maxSize) {
-                maxSize = current->size;       // Update maximum
-                worstBlock = current;          // This is new worst
-            }
+    // FAST PATH: the lowest hole of the largest size is the first fit
+    // for that size - the same hole the walk below ends up with
+    if (mm->holeTree != NULL) {
+        int largest = holeTreeLargest(mm);
+        if (largest < size) {
+            return -1;
         }
-        
-        // Move to next block
-        current = current->next;
+        return commitFit(mm, holeTreeFirstFit(mm, largest), processID, size);
     }
     
-    // STEP 3: Check if we found any suitable hole
-    if (worstBlock == NULL) {
-        return -1;  // No suitable hole found
-    }
-    
-    // STEP 4: Allocate using the worst (largest) hole
-    
-    int startAddr = worstBlock->startAddress;
-    
-    // Exact fit
-    if (worstBlock->size == size) {
-        worstBlock->isHole = 0;
-        worstBlock->processID = processID;
-        mm->numHoles--;
-    } 
-    // Split hole
-    else {
-        int newStart = worstBlock->startAddress + size;
-        int oldEnd = worstBlock->endAddress;
-        
-        worstBlock->endAddress = newStart - 1;
-        worstBlock->size = size;
-        worstBlock->isHole = 0;
-        worstBlock->processID = processID;
-        
-        // Create new hole
-        MemoryBlock *newHole = createBlock(1, newStart, oldEnd, -1);
-        newHole->next = worstBlock->next;
-        worstBlock->next = newHole;
+    // Walk the holes, keeping the largest one that is big enough; with a
+    // BlockIndex the largest size is known, so the walk stops at it
+    int target = -1;
+    if (mm->blockIndex != NULL) {
+        target = largestHoleSize(mm);
+        if (target < size) {
+            return -1;
+        }
     }
-    
-    // Update statistics
-    mm->numProcesses++;
-    mm->freeMemory -= size;
-    
-    return startAddr;
+    return commitFit(mm, searchWorstFit(mm->firstHole, size, target), processID, size);
 }
 
 /*
@@ -456,46 +632,91 @@ A restaurant menu selector:
 - Calls firstFit/bestFit/worstFit based on choice
 */
 
+static int runAlgorithm(MemoryManager *mm, int processID, int size,
+                        AllocationAlgorithm algo) {
+    
+    // Switch statement - like multiple if-else
+    // Checks the value of 'algo' and runs matching case
+    switch (algo) {
+        case FIRST_FIT:
+            return firstFit(mm, processID, size);
+            
+        case BEST_FIT:
+            return bestFit(mm, processID, size);
+            
+        case WORST_FIT:
+            return worstFit(mm, processID, size);
+            
+        default:
+            // This shouldn't happen, but just in case
+            return -1;
+    }
+}
+
 int allocateMemory(MemoryManager *mm, int processID, int size, 
                    AllocationAlgorithm algo) {
     
     // STEP 1: Validate process size
     if (size <= 0) {
-        printf("Error: Invalid process size!\n");
+        if (verboseMessages) {
+            printf("Error: Invalid process size!\n");
+        }
         return -1;
     }
     
     // STEP 2: Check if enough free memory exists
-    if (size > mm->freeMemory) {
-        printf("Error: Not enough free memory!\n");
-        printf("Requested: %d KB, Available: %d KB\n", size, mm->freeMemory);
+    // (with swapping on, anything up to all of user memory can be made free)
+    int limit = (mm->swapSpace != NULL) ? mm->userMemory : mm->freeMemory;
+    if (size > limit) {
+        if (verboseMessages) {
+            printf("Error: Not enough free memory!\n");
+            printf("Requested: %d KB, Available: %d KB\n", size, mm->freeMemory);
+        }
         return -1;
     }
     
-    // STEP 3: Call appropriate algorithm based on 'algo' parameter
+    // Incremental compaction (if on) runs before the search, so the search
+    // sees the merged holes and the address we return does not move
+    defragOnOperation(mm);
+    
+    // Bitmap backend: the bitmap is the whole memory map - no block list
+    if (mm->bitmap != NULL) {
+        return bitmapAllocate(mm, processID, size, algo);
+    }
+    
+    // Compact backend: the same fits over 16-byte blocks in one pool
+    if (mm->compactPool != NULL) {
+        return compactBackendAllocate(mm, processID, size, algo);
+    }
+    
+    // STEP 3: Deferred coalescing - a freed hole of exactly this size
+    // can be reused without any search (only when quick lists are on)
     int result;
+    MemoryBlock *cached = takeQuickBlock(mm, size);
     
-    // Switch statement - like multiple if-else
-    // Checks the value of 'algo' and runs matching case
-    switch (algo) {
-        case FIRST_FIT:
-            result = firstFit(mm, processID, size);
-            break;  // Exit switch after this case
-            
-        case BEST_FIT:
-            result = bestFit(mm, processID, size);
-            break;
-            
-        case WORST_FIT:
-            result = worstFit(mm, processID, size);
-            break;
-            
-        default:
-            // This shouldn't happen, but just in case
-            return -1;
+    if (cached != NULL) {
+        result = placeProcess(mm, cached, processID, size);
+    } else {
+        // Call appropriate algorithm based on 'algo' parameter
+        result = runAlgorithm(mm, processID, size, algo);
+        
+        // Unmerged neighbours may add up to enough - merge them and retry
+        if (result == -1 && sweepQuickLists(mm) > 0) {
+            result = runAlgorithm(mm, processID, size, algo);
+        }
+        
+        // Still no room - swap processes out until a hole fits
+        if (result == -1 && swapOutFor(mm, size) > 0) {
+            result = runAlgorithm(mm, processID, size, algo);
+        }
     }
     
-    // STEP 4: Return result from the algorithm
+    // STEP 4: Let a live viewer see the change (no-op if none attached)
+    if (result != -1) {
+        publishSharedView(mm, 0);
+    }
+    
+    // STEP 5: Return result from the algorithm
     return result;
 }
 
@@ -537,74 +758,107 @@ Merging prevents fragmentation from getting worse.
 
 int deallocateMemory(MemoryManager *mm, int processID) {
     
-    // STEP 1: Set up pointers to traverse list
-    MemoryBlock *current = mm->head;  // Block we're checking
-    MemoryBlock *prev = NULL;         // Previous block (needed for merging)
+    // Bitmap backend: clearing its bits is the whole job
+    if (mm->bitmap != NULL) {
+        return bitmapFree(mm, processID);
+    }
+    
+    // Compact backend: free and merge inside the pool
+    if (mm->compactPool != NULL) {
+        return compactBackendFree(mm, processID);
+    }
+    
+    // A segmented process has several blocks - its table lists them all
+    if (findSegmentTable(mm, processID) != NULL) {
+        return deallocateSegments(mm, processID);
+    }
+    
+    // STEP 1: Find the process
+    MemoryBlock *block = findProcessBlock(mm, processID);
+    if (block == NULL) {
+        // Not in memory - maybe it finished while swapped out
+        return discardSwapped(mm, processID);
+    }
     
-    // STEP 2: Find the process
+    // STEP 2: Convert to a hole and merge with neighbours
+    MemoryBlock *hole = releaseBlock(mm, block);
+    
+    // STEP 3: Waiting requests that fit the new hole get it now
+    admitPendingRequests(mm, (hole != NULL) ? hole->size : 0);
+    
+    // Incremental compaction (if on): a bounded amount of moving
+    defragOnOperation(mm);
+    
+    // STEP 4: Let a live viewer see the change (no-op if none attached)
+    publishSharedView(mm, 0);
+    
+    // SUCCESS!
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: findProcessBlock (shared helper)
+================================================================================
+PURPOSE: Return the block of 'processID', or NULL if it is not in memory
+
+With a BlockIndex attached this is one hash lookup; otherwise we walk
+the list from the head like before.
+*/
+
+MemoryBlock *findProcessBlock(MemoryManager *mm, int processID) {
+    
+    if (mm->blockIndex != NULL) {
+        return indexFindProcess(mm, processID);
+    }
+    
+    MemoryBlock *current = mm->head;
     while (current != NULL) {
-        
-        // Check if this is the process we're looking for
         if (!current->isHole && current->processID == processID) {
-            
-            // FOUND IT! Now deallocate.
-            
-            // STEP 3: Convert process to hole
-            current->isHole = 1;           // Mark as hole
-            current->processID = -1;       // No process ID
-            
-            // STEP 4: Update statistics
-            mm->numProcesses--;
-            mm->numHoles++;                // One more hole (for now)
-            mm->freeMemory += current->size;  // More free memory
-            
-            // STEP 5: Try to merge with NEXT block (if it's a hole)
-            if (current->next != NULL && current->next->isHole) {
-                
-                MemoryBlock *nextHole = current->next;
-                
-                // Extend current block to include next hole
-                current->endAddress = nextHole->endAddress;
-                current->size = current->endAddress - current->startAddress + 1;
-                
-                // Remove next hole from list
-                current->next = nextHole->next;
-                
-                // Free the merged hole's memory
-                free(nextHole);
-                
-                // One less hole (merged two into one)
-                mm->numHoles--;
-            }
-            
-            // STEP 6: Try to merge with PREVIOUS block (if it's a hole)
-            if (prev != NULL && prev->isHole) {
-                
-                // Extend previous block to include current
-                prev->endAddress = current->endAddress;
-                prev->size = prev->endAddress - prev->startAddress + 1;
-                
-                // Remove current from list
-                prev->next = current->next;
-                
-                // Free current block's memory
-                free(current);
-                
-                // One less hole (merged two into one)
-                mm->numHoles--;
-            }
-            
-            // SUCCESS!
-            return 1;
+            return current;
         }
-        
-        // STEP 7: Move to next block
-        prev = current;
         current = current->next;
     }
+    return NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: releaseBlock
+================================================================================
+PURPOSE: Turn one process block into a hole and merge it with neighbours
+
+Shared by deallocateMemory() and resizeMemory(). Returns the hole that
+now contains the freed space, or NULL if it went on a quick list.
+*/
+
+MemoryBlock *releaseBlock(MemoryManager *mm, MemoryBlock *block) {
+    
+    // STEP 1: Convert process to hole (updates statistics)
+    unbindBlock(mm, block);
+    
+    // Deferred coalescing: park the hole and merge it later
+    // (a sweep may already have merged it, so don't hand it back)
+    if (cacheFreedBlock(mm, block)) {
+        return NULL;
+    }
+    
+    // STEP 2: Try to merge with NEXT block (if it's a hole)
+    if (block->next != NULL && block->next->isHole) {
+        mergeWithNext(mm, block);
+    }
     
-    // STEP 8: Process not found
-    return 0;
+    // STEP 3: Try to merge with PREVIOUS block (if it's a hole)
+    // The previous hole swallows this one
+    if (block->prev != NULL && block->prev->isHole) {
+        MemoryBlock *prev = block->prev;
+        mergeWithNext(mm, prev);
+        return prev;
+    }
+    
+    return block;
 }
 
 /*
@@ -646,6 +900,18 @@ WHAT IT DISPLAYS:
 
 void displayMemory(MemoryManager *mm) {
     
+    // The bitmap backend has no blocks to list - show the bitmap instead
+    if (mm->bitmap != NULL) {
+        displayBitmap(mm);
+        return;
+    }
+    
+    // Same for the compact backend - its blocks live in the pool
+    if (mm->compactPool != NULL) {
+        displayCompactPool(mm->compactPool);
+        return;
+    }
+    
     // Print header
     printf("\n========== MEMORY STATE ==========\n");
     printf("|  Type  |   Address   |    Size     |\n");
@@ -692,16 +958,8 @@ float calculateFragmentation(MemoryManager *mm) {
         return 0.0;
     }
     
-    // Find the largest hole
-    int largestHole = 0;
-    MemoryBlock *current = mm->head;
-    
-    while (current != NULL) {
-        if (current->isHole && current->size > largestHole) {
-            largestHole = current->size;
-        }
-        current = current->next;
-    }
+    // Find the largest hole (top of the hole heap if an index is attached)
+    int largestHole = largestHoleSize(mm);
     
     // Calculate fragmented memory
     // This is the free memory that's NOT in the largest hole
@@ -741,6 +999,28 @@ This function walks through the entire linked list and frees each block.
 
 void freeMemoryManager(MemoryManager *mm) {
     
+    // Quick lists point into the block list - drop them (no sweep needed,
+    // every block is about to be freed anyway)
+    if (mm->quickLists != NULL) {
+        free(mm->quickLists->heads);
+        mm->quickLists->heads = NULL;
+        mm->quickLists = NULL;
+    }
+    
+    // Waiting requests can never be placed now - drop them
+    disableAdmissionQueue(mm);
+    
+    // Same for swapped-out processes, segment tables, then the indexes
+    disableSwapping(mm);
+    disableSegmentation(mm);
+    disableBlockIndex(mm);
+    disableHoleTree(mm);
+    disableAddressIndex(mm);
+    disableUsageMap(mm);
+    disableBitmapBackend(mm);
+    disableCompactBackend(mm);
+    disableDefragmenter(mm);
+    
     MemoryBlock *current = mm->head;
     
     // Walk through list and free each block
@@ -752,6 +1032,7 @@ void freeMemoryManager(MemoryManager *mm) {
     
     // Set head to NULL (list is now empty)
     mm->head = NULL;
+    mm->firstHole = NULL;
 }
 
 /*
@@ -773,11 +1054,13 @@ END OF FILE: memory_manager.c
 
 WHAT WE IMPLEMENTED:
 1. initializeMemory() - Set up initial memory state
+   (resetMemoryManager() clears every field first)
 2. firstFit() - First Fit allocation algorithm
 3. bestFit() - Best Fit allocation algorithm  
 4. worstFit() - Worst Fit allocation algorithm
 5. allocateMemory() - Main allocation function (wrapper)
 6. deallocateMemory() - Free memory and merge holes
+   (releaseBlock() does the work; resizeMemory() uses it too)
 7. displayMemory() - Show memory state
 8. calculateFragmentation() - Measure fragmentation
 9. freeMemoryManager() - Clean up memory
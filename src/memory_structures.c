@@ -93,6 +93,32 @@ MemoryBlock* createBlock(int isHole, int start, int end, int pid) {
     // NULL means "points to nothing"
     newBlock->next = NULL;
     
+    // Not on any quick list yet (only used in deferred coalescing mode)
+    newBlock->inQuickList = 0;
+    newBlock->quickPrev = NULL;
+    newBlock->quickNext = NULL;
+    
+    // Not linked to a previous block or into any index yet
+    newBlock->prev = NULL;
+    newBlock->holeHeapIndex = -1;
+    newBlock->pidNext = NULL;
+    newBlock->lastUsed = 0;
+    newBlock->segment = -1;
+    newBlock->prevHole = NULL;
+    newBlock->nextHole = NULL;
+    newBlock->treeLeft = NULL;
+    newBlock->treeRight = NULL;
+    newBlock->treePriority = 0;
+    newBlock->subtreeMax = 0;
+    newBlock->addrLeft = NULL;
+    newBlock->addrRight = NULL;
+    newBlock->addrPriority = 0;
+    newBlock->lruOlder = NULL;
+    newBlock->lruNewer = NULL;
+    newBlock->sizeLeft = NULL;
+    newBlock->sizeRight = NULL;
+    newBlock->sizePriority = 0;
+    
     // STEP 4: Return pointer to the newly created block
     return newBlock;
 }
@@ -0,0 +1,304 @@
+/*
+================================================================================
+FILE: numa.c
+PURPOSE: Implement NUMA nodes, fallback policies and locality counters
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/numa.h"
+
+
+/*
+================================================================================
+FUNCTION: initNuma
+================================================================================
+*/
+
+int initNuma(NumaSystem *ns, const int nodeSizes[], int numNodes, int osMemory,
+             const int *distances, NumaPolicy policy) {
+
+    // STEP 1: Validate
+    if (numNodes <= 0 || numNodes > MAX_NUMA_NODES || osMemory < 0) {
+        printf("Error: A NUMA system has 1 to %d nodes!\n", MAX_NUMA_NODES);
+        return 0;
+    }
+    for (int n = 0; n < numNodes; n++) {
+        if (nodeSizes[n] <= 0) {
+            printf("Error: Invalid node size!\n");
+            return 0;
+        }
+    }
+
+    ns->numNodes = numNodes;
+    ns->policy = policy;
+    ns->nextInterleave = 0;
+
+    // STEP 2: One manager per node, each starting where the last ended
+    // (for node N the "OS" part is everything below its range)
+    int base = osMemory;
+    for (int n = 0; n < numNodes; n++) {
+        NumaNode *node = &ns->nodes[n];
+        initializeMemory(&node->mm, base + nodeSizes[n], base);
+        node->size = nodeSizes[n];
+        node->localAllocs = 0;
+        node->remoteAllocs = 0;
+        node->failedAllocs = 0;
+        node->servedForOthers = 0;
+
+        // STEP 3: Its own hole index, so "does it fit here?" is O(1)
+        if (!enableBlockIndex(&node->mm, &node->index)) {
+            for (int m = 0; m <= n; m++) {
+                freeMemoryManager(&ns->nodes[m].mm);
+            }
+            return 0;
+        }
+        base += nodeSizes[n];
+    }
+
+    // STEP 4: Distances (default: local 10, remote 20)
+    for (int a = 0; a < numNodes; a++) {
+        for (int b = 0; b < numNodes; b++) {
+            if (distances != NULL) {
+                ns->distance[a][b] = distances[a * numNodes + b];
+            } else {
+                ns->distance[a][b] = (a == b) ? NUMA_LOCAL_DISTANCE : NUMA_REMOTE_DISTANCE;
+            }
+        }
+    }
+
+    // STEP 5: Fallback order per node - sorted by distance, the node
+    // itself first, ties by node number (insertion sort, n <= 8)
+    for (int a = 0; a < numNodes; a++) {
+        int *order = ns->fallbackOrder[a];
+        int count = 0;
+        order[count++] = a;
+        for (int b = 0; b < numNodes; b++) {
+            if (b == a) {
+                continue;
+            }
+            int i = count++;
+            while (i > 1 && ns->distance[a][order[i - 1]] > ns->distance[a][b]) {
+                order[i] = order[i - 1];
+                i--;
+            }
+            order[i] = b;
+        }
+    }
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: numaAllocate
+================================================================================
+*/
+
+int numaAllocate(NumaSystem *ns, int processID, int size, int preferredNode,
+                 AllocationAlgorithm algo) {
+
+    // STEP 1: Validate
+    if (preferredNode < 0 || preferredNode >= ns->numNodes) {
+        printf("Error: Invalid NUMA node %d!\n", preferredNode);
+        return -1;
+    }
+    if (size <= 0) {
+        printf("Error: Invalid process size!\n");
+        return -1;
+    }
+    if (numaNodeOf(ns, processID) != -1) {
+        printf("Error: P%d is already in memory!\n", processID);
+        return -1;
+    }
+
+    // STEP 2: Which nodes may be tried, in which order
+    int start = preferredNode;
+    int tries = ns->numNodes;
+    if (ns->policy == NUMA_LOCAL_ONLY) {
+        tries = 1;
+    } else if (ns->policy == NUMA_INTERLEAVE) {
+        start = ns->nextInterleave;
+        ns->nextInterleave = (ns->nextInterleave + 1) % ns->numNodes;
+    }
+
+    // STEP 3: First node whose largest hole fits gets the process
+    for (int i = 0; i < tries; i++) {
+        int n = ns->fallbackOrder[start][i];
+        NumaNode *node = &ns->nodes[n];
+
+        if (largestHoleSize(&node->mm) < size) {
+            continue;       // Hole heap says no - skip without a search
+        }
+
+        int address = allocateMemory(&node->mm, processID, size, algo);
+        if (address == -1) {
+            continue;
+        }
+
+        // STEP 4: Count local vs remote against the preferred node
+        if (n == preferredNode) {
+            ns->nodes[preferredNode].localAllocs++;
+        } else {
+            ns->nodes[preferredNode].remoteAllocs++;
+            node->servedForOthers++;
+        }
+        return address;
+    }
+
+    ns->nodes[preferredNode].failedAllocs++;
+    return -1;
+}
+
+
+/*
+================================================================================
+FUNCTION: numaDeallocate / numaNodeOf
+================================================================================
+*/
+
+int numaNodeOf(NumaSystem *ns, int processID) {
+    for (int n = 0; n < ns->numNodes; n++) {
+        if (indexFindProcess(&ns->nodes[n].mm, processID) != NULL) {
+            return n;
+        }
+    }
+    return -1;
+}
+
+int numaDeallocate(NumaSystem *ns, int processID) {
+    int n = numaNodeOf(ns, processID);
+
+    if (n == -1) {
+        printf("Error: Process P%d not found!\n", processID);
+        return 0;
+    }
+    return deallocateMemory(&ns->nodes[n].mm, processID);
+}
+
+
+/*
+================================================================================
+FUNCTION: numaRemoteRatio
+================================================================================
+*/
+
+double numaRemoteRatio(NumaSystem *ns) {
+    long local = 0;
+    long remote = 0;
+
+    for (int n = 0; n < ns->numNodes; n++) {
+        local += ns->nodes[n].localAllocs;
+        remote += ns->nodes[n].remoteAllocs;
+    }
+    if (local + remote == 0) {
+        return 0.0;
+    }
+    return (double)remote / (double)(local + remote);
+}
+
+
+/*
+================================================================================
+FUNCTION: displayNumaStats
+================================================================================
+*/
+
+void displayNumaStats(NumaSystem *ns) {
+    const char *names[] = {"local only", "nearest", "interleave"};
+    long local = 0;
+    long remote = 0;
+
+    printf("NUMA (%s), %d nodes\n", names[ns->policy], ns->numNodes);
+    printf("Node  Range        Free    Frag     Local  Remote  Failed  Served\n");
+    for (int n = 0; n < ns->numNodes; n++) {
+        NumaNode *node = &ns->nodes[n];
+        char range[24];
+        char freeText[16];
+        char fragText[16];
+
+        snprintf(range, sizeof(range), "%d-%d", node->mm.osMemory, node->mm.totalMemory - 1);
+        snprintf(freeText, sizeof(freeText), "%d KB", node->mm.freeMemory);
+        snprintf(fragText, sizeof(fragText), "%.2f%%", calculateFragmentation(&node->mm));
+        printf("%-5d %-12s %-7s %-8s %-6ld %-7ld %-7ld %ld\n", n, range, freeText, fragText,
+               node->localAllocs, node->remoteAllocs, node->failedAllocs, node->servedForOthers);
+
+        local += node->localAllocs;
+        remote += node->remoteAllocs;
+    }
+    printf("Remote allocations: %ld of %ld (%.2f%%)\n",
+           remote, local + remote, numaRemoteRatio(ns) * 100.0);
+}
+
+
+/*
+================================================================================
+FUNCTION: freeNuma
+================================================================================
+*/
+
+void freeNuma(NumaSystem *ns) {
+    for (int n = 0; n < ns->numNodes; n++) {
+        freeMemoryManager(&ns->nodes[n].mm);     // Also drops its index
+    }
+    ns->numNodes = 0;
+}
+
+
+/*
+================================================================================
+FUNCTION: runNumaWorkload
+================================================================================
+*/
+
+long runNumaWorkload(NumaSystem *ns, int numOps, int maxSize, unsigned int seed,
+                     AllocationAlgorithm algo) {
+    int *live = (int *)malloc(sizeof(int) * (numOps + 1));
+    int numLive = 0;
+    long placed = 0;
+    unsigned int state = seed;
+
+    if (live == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    for (int pid = 1; pid <= numOps; pid++) {
+        state = state * 1103515245u + 12345u;
+        unsigned int r = state >> 8;
+
+        if (numLive > 0 && r % 3 == 0) {
+            // Free a random live process
+            int i = (int)((r / 3) % (unsigned int)numLive);
+            numaDeallocate(ns, live[i]);
+            live[i] = live[--numLive];
+        } else {
+            // 1 - maxSize KB, from the CPU on node (pid % nodes)
+            int size = 1 + (int)((r / 3) % (unsigned int)maxSize);
+            if (numaAllocate(ns, pid, size, pid % ns->numNodes, algo) != -1) {
+                live[numLive++] = pid;
+                placed++;
+            }
+        }
+    }
+
+    free(live);
+    return placed;
+}
+
+
+/*
+================================================================================
+END OF FILE: numa.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. initNuma() - Consecutive node ranges, hole index per node, fallback order
+2. numaAllocate() - Local only / nearest / interleave placement
+3. numaDeallocate() / numaNodeOf() - Free on the owning node
+4. numaRemoteRatio() / displayNumaStats() - Locality and per-node fragmentation
+5. freeNuma()
+6. runNumaWorkload() - Reproducible random churn over every node
+================================================================================
+*/
@@ -0,0 +1,513 @@
+/*
+================================================================================
+FILE: page_replacement.c
+PURPOSE: Implement reference-string replay for LRU, CLOCK, second chance
+         and ARC
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/page_replacement.h"
+
+// ARC's four lists (LRU, CLOCK and second chance only use lists[0])
+#define T1 0        // Resident, seen once recently
+#define T2 1        // Resident, seen at least twice
+#define B1 2        // Ghosts evicted from T1 (page number only)
+#define B2 3        // Ghosts evicted from T2
+
+
+/*
+================================================================================
+HASH MAP (internal helpers)
+================================================================================
+*/
+
+static unsigned int homeSlot(ReplacementSim *rs, unsigned int page) {
+    unsigned int h = page * 0x9E3779B1u;
+    return (h ^ (h >> 16)) & rs->hashMask;
+}
+
+static int hashFind(ReplacementSim *rs, unsigned int page) {
+    unsigned int slot = homeSlot(rs, page);
+    while (rs->hashNodes[slot] != -1) {
+        if (rs->hashPages[slot] == page) {
+            return rs->hashNodes[slot];
+        }
+        slot = (slot + 1) & rs->hashMask;
+    }
+    return -1;
+}
+
+static void hashInsert(ReplacementSim *rs, unsigned int page, int node) {
+    unsigned int slot = homeSlot(rs, page);
+    while (rs->hashNodes[slot] != -1) {
+        slot = (slot + 1) & rs->hashMask;
+    }
+    rs->hashPages[slot] = page;
+    rs->hashNodes[slot] = node;
+}
+
+static void hashRemove(ReplacementSim *rs, unsigned int page) {
+    unsigned int hole = homeSlot(rs, page);
+    while (rs->hashPages[hole] != page || rs->hashNodes[hole] == -1) {
+        hole = (hole + 1) & rs->hashMask;
+    }
+
+    // Shift back every later entry that would no longer be reachable
+    unsigned int slot = hole;
+    while (1) {
+        slot = (slot + 1) & rs->hashMask;
+        if (rs->hashNodes[slot] == -1) {
+            break;
+        }
+        unsigned int home = homeSlot(rs, rs->hashPages[slot]);
+        // Distance home→slot vs home→hole: move if the hole is on the way
+        if (((slot - home) & rs->hashMask) >= ((slot - hole) & rs->hashMask)) {
+            rs->hashPages[hole] = rs->hashPages[slot];
+            rs->hashNodes[hole] = rs->hashNodes[slot];
+            hole = slot;
+        }
+    }
+    rs->hashNodes[hole] = -1;
+}
+
+
+/*
+================================================================================
+INTRUSIVE LISTS (internal helpers)
+================================================================================
+*/
+
+static void listRemove(ReplacementSim *rs, int node) {
+    PageNode *n = &rs->nodes[node];
+    PageList *list = &rs->lists[n->list];
+
+    if (n->prev != -1) {
+        rs->nodes[n->prev].next = n->next;
+    } else {
+        list->head = n->next;
+    }
+    if (n->next != -1) {
+        rs->nodes[n->next].prev = n->prev;
+    } else {
+        list->tail = n->prev;
+    }
+    list->size--;
+}
+
+static void listPushHead(ReplacementSim *rs, int listID, int node) {
+    PageNode *n = &rs->nodes[node];
+    PageList *list = &rs->lists[listID];
+
+    n->list = (unsigned char)listID;
+    n->prev = -1;
+    n->next = list->head;
+    if (list->head != -1) {
+        rs->nodes[list->head].prev = node;
+    } else {
+        list->tail = node;
+    }
+    list->head = node;
+    list->size++;
+}
+
+// Take a node from the unused chain and register 'page' for it
+static int newNode(ReplacementSim *rs, unsigned int page) {
+    int node = rs->freeNode;
+    rs->freeNode = rs->nodes[node].next;
+    rs->nodes[node].page = page;
+    rs->nodes[node].referenced = 1;
+    hashInsert(rs, page, node);
+    return node;
+}
+
+// Unlink the tail of a list and forget its page entirely
+static int dropTail(ReplacementSim *rs, int listID) {
+    int node = rs->lists[listID].tail;
+    listRemove(rs, node);
+    hashRemove(rs, rs->nodes[node].page);
+    rs->nodes[node].next = rs->freeNode;
+    rs->freeNode = node;
+    return node;
+}
+
+
+/*
+================================================================================
+FUNCTION: initReplacement / freeReplacement
+================================================================================
+*/
+
+int initReplacement(ReplacementSim *rs, ReplacementPolicy policy, int numFrames) {
+
+    if (numFrames <= 0) {
+        printf("Error: Invalid number of frames!\n");
+        return 0;
+    }
+
+    // STEP 1: One node per frame (ARC also keeps as many ghosts)
+    rs->policy = policy;
+    rs->numFrames = numFrames;
+    rs->numNodes = (policy == REPLACE_ARC) ? 2 * numFrames : numFrames;
+
+    // STEP 2: Hash map at most half full
+    unsigned int capacity = 16;
+    while (capacity < 2u * rs->numNodes) {
+        capacity *= 2;
+    }
+    rs->hashMask = capacity - 1;
+
+    rs->nodes = (PageNode *)malloc(sizeof(PageNode) * rs->numNodes);
+    rs->hashPages = (unsigned int *)malloc(sizeof(unsigned int) * capacity);
+    rs->hashNodes = (int *)malloc(sizeof(int) * capacity);
+    if (rs->nodes == NULL || rs->hashPages == NULL || rs->hashNodes == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(rs->nodes);
+        free(rs->hashPages);
+        free(rs->hashNodes);
+        return 0;
+    }
+    for (unsigned int s = 0; s < capacity; s++) {
+        rs->hashNodes[s] = -1;
+    }
+
+    // STEP 3: Every node unused, every list empty
+    for (int i = 0; i < rs->numNodes; i++) {
+        rs->nodes[i].next = (i + 1 < rs->numNodes) ? i + 1 : -1;
+    }
+    rs->freeNode = 0;
+    for (int l = 0; l < 4; l++) {
+        rs->lists[l].head = -1;
+        rs->lists[l].tail = -1;
+        rs->lists[l].size = 0;
+    }
+    rs->clockHand = 0;
+    rs->arcTarget = 0;
+
+    rs->references = 0;
+    rs->faults = 0;
+    rs->evictions = 0;
+    return 1;
+}
+
+void freeReplacement(ReplacementSim *rs) {
+    free(rs->nodes);
+    free(rs->hashPages);
+    free(rs->hashNodes);
+    rs->nodes = NULL;
+    rs->hashPages = NULL;
+    rs->hashNodes = NULL;
+}
+
+
+/*
+================================================================================
+POLICIES (internal helpers)
+================================================================================
+Each returns 1 on a page fault, 0 on a hit.
+*/
+
+static int accessLRU(ReplacementSim *rs, unsigned int page) {
+    int node = hashFind(rs, page);
+
+    // Hit: move to the front
+    if (node != -1) {
+        listRemove(rs, node);
+        listPushHead(rs, T1, node);
+        return 0;
+    }
+
+    // Fault: full → evict the back (least recently used)
+    if (rs->lists[T1].size == rs->numFrames) {
+        dropTail(rs, T1);
+        rs->evictions++;
+    }
+    listPushHead(rs, T1, newNode(rs, page));
+    return 1;
+}
+
+static int accessClock(ReplacementSim *rs, unsigned int page) {
+    int node = hashFind(rs, page);
+
+    if (node != -1) {
+        rs->nodes[node].referenced = 1;
+        return 0;
+    }
+
+    // Fault, frames still empty: nodes fill the circle in order
+    if (rs->lists[T1].size < rs->numFrames) {
+        rs->lists[T1].size++;
+        newNode(rs, page);
+        return 1;
+    }
+
+    // Fault, full: sweep, clearing bits, until an unreferenced frame
+    while (rs->nodes[rs->clockHand].referenced) {
+        rs->nodes[rs->clockHand].referenced = 0;
+        rs->clockHand = (rs->clockHand + 1 == rs->numFrames) ? 0 : rs->clockHand + 1;
+    }
+    node = rs->clockHand;
+    hashRemove(rs, rs->nodes[node].page);
+    rs->nodes[node].page = page;
+    rs->nodes[node].referenced = 1;
+    hashInsert(rs, page, node);
+    rs->clockHand = (node + 1 == rs->numFrames) ? 0 : node + 1;
+    rs->evictions++;
+    return 1;
+}
+
+static int accessSecondChance(ReplacementSim *rs, unsigned int page) {
+    int node = hashFind(rs, page);
+
+    if (node != -1) {
+        rs->nodes[node].referenced = 1;
+        return 0;
+    }
+
+    // Fault, full: oldest page with its bit set goes to the back once
+    if (rs->lists[T1].size == rs->numFrames) {
+        int oldest = rs->lists[T1].tail;
+        while (rs->nodes[oldest].referenced) {
+            rs->nodes[oldest].referenced = 0;
+            listRemove(rs, oldest);
+            listPushHead(rs, T1, oldest);
+            oldest = rs->lists[T1].tail;
+        }
+        dropTail(rs, T1);
+        rs->evictions++;
+    }
+    listPushHead(rs, T1, newNode(rs, page));
+    return 1;
+}
+
+// ARC's REPLACE: move one resident page to its ghost list
+static void arcReplace(ReplacementSim *rs, int hitInB2) {
+    int t1 = rs->lists[T1].size;
+    int fromT1 = (t1 >= 1 && ((hitInB2 && t1 == rs->arcTarget) || t1 > rs->arcTarget));
+
+    if (!fromT1 && rs->lists[T2].size == 0) {
+        fromT1 = 1;
+    }
+    int node = rs->lists[fromT1 ? T1 : T2].tail;
+    listRemove(rs, node);
+    listPushHead(rs, fromT1 ? B1 : B2, node);
+    rs->evictions++;
+}
+
+static int accessARC(ReplacementSim *rs, unsigned int page) {
+    int c = rs->numFrames;
+    int node = hashFind(rs, page);
+
+    if (node != -1) {
+        int list = rs->nodes[node].list;
+
+        // CASE I: resident → hit, now "used often"
+        if (list == T1 || list == T2) {
+            listRemove(rs, node);
+            listPushHead(rs, T2, node);
+            return 0;
+        }
+
+        // CASE II / III: ghost hit → adapt the target, reload into T2
+        if (list == B1) {
+            int step = (rs->lists[B2].size > rs->lists[B1].size) ?
+                       rs->lists[B2].size / rs->lists[B1].size : 1;
+            rs->arcTarget = (rs->arcTarget + step < c) ? rs->arcTarget + step : c;
+            arcReplace(rs, 0);
+        } else {
+            int step = (rs->lists[B1].size > rs->lists[B2].size) ?
+                       rs->lists[B1].size / rs->lists[B2].size : 1;
+            rs->arcTarget = (rs->arcTarget - step > 0) ? rs->arcTarget - step : 0;
+            arcReplace(rs, 1);
+        }
+        listRemove(rs, node);
+        listPushHead(rs, T2, node);
+        return 1;
+    }
+
+    // CASE IV: never seen (or forgotten)
+    int t1b1 = rs->lists[T1].size + rs->lists[B1].size;
+    int total = t1b1 + rs->lists[T2].size + rs->lists[B2].size;
+
+    if (t1b1 == c) {
+        if (rs->lists[T1].size < c) {
+            dropTail(rs, B1);
+            arcReplace(rs, 0);
+        } else {
+            dropTail(rs, T1);
+            rs->evictions++;
+        }
+    } else if (total >= c) {
+        if (total == 2 * c) {
+            dropTail(rs, B2);
+        }
+        arcReplace(rs, 0);
+    }
+    listPushHead(rs, T1, newNode(rs, page));
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: replayReferences
+================================================================================
+The policy is chosen once per chunk, so the inner loops have no switch.
+*/
+
+long long replayReferences(ReplacementSim *rs, const unsigned int pages[], long long n) {
+    long long faults = 0;
+
+    switch (rs->policy) {
+        case REPLACE_LRU:
+            for (long long i = 0; i < n; i++) faults += accessLRU(rs, pages[i]);
+            break;
+        case REPLACE_CLOCK:
+            for (long long i = 0; i < n; i++) faults += accessClock(rs, pages[i]);
+            break;
+        case REPLACE_SECOND_CHANCE:
+            for (long long i = 0; i < n; i++) faults += accessSecondChance(rs, pages[i]);
+            break;
+        case REPLACE_ARC:
+            for (long long i = 0; i < n; i++) faults += accessARC(rs, pages[i]);
+            break;
+    }
+
+    rs->references += n;
+    rs->faults += faults;
+    return faults;
+}
+
+
+/*
+================================================================================
+FUNCTION: replayReferenceFile
+================================================================================
+Reads fixed-size chunks, so memory use does not depend on the file size.
+*/
+
+#define FILE_CHUNK (1 << 20)
+
+long long replayReferenceFile(ReplacementSim *rs, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("Error: Cannot open %s!\n", path);
+        return -1;
+    }
+
+    unsigned int *chunk = (unsigned int *)malloc(sizeof(unsigned int) * FILE_CHUNK);
+    if (chunk == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        fclose(file);
+        return -1;
+    }
+
+    long long faults = 0;
+    size_t count;
+    while ((count = fread(chunk, sizeof(unsigned int), FILE_CHUNK, file)) > 0) {
+        faults += replayReferences(rs, chunk, (long long)count);
+    }
+
+    free(chunk);
+    fclose(file);
+    return faults;
+}
+
+
+/*
+================================================================================
+FUNCTION: loadReferenceFile
+================================================================================
+The whole log in one array - for compareReplacementPolicies(), which
+replays the same references once per policy.
+*/
+
+unsigned int *loadReferenceFile(const char *path, long long *n) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("Error: Cannot open %s!\n", path);
+        return NULL;
+    }
+
+    // STEP 1: Size of the file → number of references
+    fseek(file, 0, SEEK_END);
+    long bytes = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (bytes < 0) {
+        printf("Error: Cannot read %s!\n", path);
+        fclose(file);
+        return NULL;
+    }
+    *n = bytes / (long)sizeof(unsigned int);
+
+    // STEP 2: Read them all (at least one slot, so an empty log is not an error)
+    unsigned int *pages = (unsigned int *)malloc(sizeof(unsigned int) * (*n > 0 ? *n : 1));
+    if (pages == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        fclose(file);
+        return NULL;
+    }
+    *n = (long long)fread(pages, sizeof(unsigned int), (size_t)*n, file);
+    fclose(file);
+    return pages;
+}
+
+
+/*
+================================================================================
+FUNCTION: displayReplacementStats / compareReplacementPolicies
+================================================================================
+*/
+
+static const char *policyName(ReplacementPolicy policy) {
+    const char *names[] = {"LRU", "CLOCK", "Second chance", "ARC"};
+    return names[policy];
+}
+
+void displayReplacementStats(ReplacementSim *rs) {
+    double rate = (rs->references > 0) ? (double)rs->faults / rs->references * 100 : 0.0;
+
+    printf("%s with %d frames: %lld references, %lld faults (%.2f%%), %lld evictions\n",
+           policyName(rs->policy), rs->numFrames, rs->references,
+           rs->faults, rate, rs->evictions);
+}
+
+void compareReplacementPolicies(const unsigned int pages[], long long n, int numFrames) {
+    printf("%-15s %-12s %-12s %s\n", "Policy", "Faults", "Fault rate", "Million refs/s");
+
+    for (int p = REPLACE_LRU; p <= REPLACE_ARC; p++) {
+        ReplacementSim rs;
+        if (!initReplacement(&rs, (ReplacementPolicy)p, numFrames)) {
+            return;
+        }
+
+        clock_t start = clock();
+        replayReferences(&rs, pages, n);
+        double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        char rate[16];
+        snprintf(rate, sizeof(rate), "%.2f%%", (n > 0) ? (double)rs.faults / n * 100 : 0.0);
+        printf("%-15s %-12lld %-12s %.1f\n", policyName(rs.policy), rs.faults, rate,
+               (seconds > 0) ? n / seconds / 1e6 : 0.0);
+        freeReplacement(&rs);
+    }
+}
+
+
+/*
+================================================================================
+END OF FILE: page_replacement.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. Open-addressing hash map with backward-shift removal
+2. Intrusive lists over a node array (no malloc per access)
+3. accessLRU / accessClock / accessSecondChance / accessARC
+4. replayReferences() - Chunked replay, one policy switch per chunk
+   replayReferenceFile() - Stream a binary log through it
+   loadReferenceFile() - Read a whole log into memory
+5. displayReplacementStats() / compareReplacementPolicies()
+================================================================================
+*/
@@ -0,0 +1,304 @@
+/*
+================================================================================
+FILE: paging.c
+PURPOSE: Implement the frame bitmap and page tables
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/paging.h"
+
+#define BITS_PER_WORD 64
+#define FULL_WORD (~0ULL)
+
+
+/*
+================================================================================
+FUNCTION: initPaging
+================================================================================
+*/
+
+int initPaging(PagingSystem *ps, const MemoryManager *mm, int pageSize) {
+
+    // STEP 1: Validate the page size
+    if (pageSize <= 0 || pageSize > mm->userMemory) {
+        printf("Error: Invalid page size!\n");
+        return 0;
+    }
+
+    // STEP 2: Frames cover the user region
+    ps->pageSize = pageSize;
+    ps->baseAddress = mm->osMemory;
+    ps->numFrames = mm->userMemory / pageSize;
+    ps->freeFrames = ps->numFrames;
+    ps->internalWaste = 0;
+
+    // STEP 3: All frames free; bits past the last frame stay "used"
+    // so the search can never hand them out
+    ps->numWords = (ps->numFrames + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    ps->firstFreeWord = 0;
+    ps->frameBitmap = (unsigned long long *)calloc(ps->numWords, sizeof(unsigned long long));
+
+    ps->tableCapacity = 16;
+    ps->numTables = 0;
+    ps->tables = (PageTable *)malloc(sizeof(PageTable) * ps->tableCapacity);
+
+    if (ps->frameBitmap == NULL || ps->tables == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(ps->frameBitmap);
+        free(ps->tables);
+        return 0;
+    }
+
+    int usedBits = ps->numFrames % BITS_PER_WORD;
+    if (usedBits != 0) {
+        ps->frameBitmap[ps->numWords - 1] = FULL_WORD << usedBits;
+    }
+    return 1;
+}
+
+
+/*
+================================================================================
+FRAME BITMAP (internal helpers)
+================================================================================
+*/
+
+// Lowest free frame, or -1 if all are used
+static int findFreeFrame(PagingSystem *ps) {
+    for (int w = ps->firstFreeWord; w < ps->numWords; w++) {
+        unsigned long long word = ps->frameBitmap[w];
+        if (word != FULL_WORD) {
+            ps->firstFreeWord = w;
+            // First 0 bit = number of trailing 1 bits
+            return w * BITS_PER_WORD + __builtin_ctzll(~word);
+        }
+    }
+    ps->firstFreeWord = ps->numWords;
+    return -1;
+}
+
+static void markFrame(PagingSystem *ps, int frame, int used) {
+    int w = frame / BITS_PER_WORD;
+    unsigned long long bit = 1ULL << (frame % BITS_PER_WORD);
+
+    if (used) {
+        ps->frameBitmap[w] |= bit;
+        ps->freeFrames--;
+    } else {
+        ps->frameBitmap[w] &= ~bit;
+        ps->freeFrames++;
+        if (w < ps->firstFreeWord) {
+            ps->firstFreeWord = w;
+        }
+    }
+}
+
+static int findTable(PagingSystem *ps, int processID) {
+    for (int i = 0; i < ps->numTables; i++) {
+        if (ps->tables[i].processID == processID) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+/*
+================================================================================
+FUNCTION: pagingAllocate
+================================================================================
+*/
+
+int pagingAllocate(PagingSystem *ps, int processID, int size) {
+
+    // STEP 1: Validate and count pages (round up)
+    if (size <= 0) {
+        printf("Error: Invalid process size!\n");
+        return -1;
+    }
+    int numPages = (size + ps->pageSize - 1) / ps->pageSize;
+
+    // STEP 2: All or nothing - enough frames anywhere?
+    if (numPages > ps->freeFrames) {
+        return -1;
+    }
+
+    // STEP 3: New page table
+    if (ps->numTables == ps->tableCapacity) {
+        int newCapacity = ps->tableCapacity * 2;
+        PageTable *bigger = (PageTable *)realloc(ps->tables, sizeof(PageTable) * newCapacity);
+        if (bigger == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return -1;
+        }
+        ps->tables = bigger;
+        ps->tableCapacity = newCapacity;
+    }
+    PageTable *table = &ps->tables[ps->numTables];
+    table->frames = (int *)malloc(sizeof(int) * numPages);
+    if (table->frames == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return -1;
+    }
+    table->processID = processID;
+    table->size = size;
+    table->numPages = numPages;
+    ps->numTables++;
+
+    // STEP 4: Each page takes the lowest free frame
+    for (int page = 0; page < numPages; page++) {
+        int frame = findFreeFrame(ps);
+        markFrame(ps, frame, 1);
+        table->frames[page] = frame;
+    }
+
+    // STEP 5: The unused end of the last page is internal fragmentation
+    ps->internalWaste += numPages * ps->pageSize - size;
+
+    return ps->baseAddress + table->frames[0] * ps->pageSize;
+}
+
+
+/*
+================================================================================
+FUNCTION: pagingFree
+================================================================================
+*/
+
+int pagingFree(PagingSystem *ps, int processID) {
+    int i = findTable(ps, processID);
+    if (i == -1) {
+        return 0;
+    }
+
+    PageTable *table = &ps->tables[i];
+    for (int page = 0; page < table->numPages; page++) {
+        markFrame(ps, table->frames[page], 0);
+    }
+    ps->internalWaste -= table->numPages * ps->pageSize - table->size;
+    free(table->frames);
+
+    // Fill the gap with the last table (order does not matter)
+    ps->tables[i] = ps->tables[--ps->numTables];
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: translateAddress
+================================================================================
+*/
+
+int translateAddress(PagingSystem *ps, int processID, int logicalAddress) {
+    int i = findTable(ps, processID);
+    if (i == -1 || logicalAddress < 0 || logicalAddress >= ps->tables[i].size) {
+        return -1;
+    }
+
+    int page = logicalAddress / ps->pageSize;
+    int offset = logicalAddress % ps->pageSize;
+    return ps->baseAddress + ps->tables[i].frames[page] * ps->pageSize + offset;
+}
+
+
+/*
+================================================================================
+FUNCTION: pagingFragmentation
+================================================================================
+*/
+
+float pagingFragmentation(PagingSystem *ps) {
+    int userMemory = ps->numFrames * ps->pageSize;
+    return (userMemory > 0) ? (float)ps->internalWaste / userMemory * 100 : 0.0f;
+}
+
+
+/*
+================================================================================
+FUNCTION: displayPaging
+================================================================================
+*/
+
+void displayPaging(PagingSystem *ps) {
+
+    // STEP 1: Frame map - last digit of the owner's ID, '.' if free
+    char *map = (char *)malloc(ps->numFrames + 1);
+    if (map != NULL) {
+        for (int f = 0; f < ps->numFrames; f++) {
+            map[f] = '.';
+        }
+        for (int i = 0; i < ps->numTables; i++) {
+            for (int page = 0; page < ps->tables[i].numPages; page++) {
+                map[ps->tables[i].frames[page]] = '0' + ps->tables[i].processID % 10;
+            }
+        }
+        map[ps->numFrames] = '\0';
+        printf("Frames: [%s]\n", map);
+        free(map);
+    }
+
+    // STEP 2: One line per page table, runs of frames shown as a-b
+    for (int i = 0; i < ps->numTables; i++) {
+        PageTable *table = &ps->tables[i];
+        printf("P%d: %d KB in %d pages (%d KB unused) → frames ",
+               table->processID, table->size, table->numPages,
+               table->numPages * ps->pageSize - table->size);
+
+        int runStart = 0;
+        for (int page = 1; page <= table->numPages; page++) {
+            if (page < table->numPages &&
+                table->frames[page] == table->frames[page - 1] + 1) {
+                continue;
+            }
+            if (runStart > 0) {
+                printf(", ");
+            }
+            if (page - 1 == runStart) {
+                printf("%d", table->frames[runStart]);
+            } else {
+                printf("%d-%d", table->frames[runStart], table->frames[page - 1]);
+            }
+            runStart = page;
+        }
+        printf("\n");
+    }
+
+    printf("Free frames: %d / %d | Internal fragmentation: %d KB (%.2f%%)\n",
+           ps->freeFrames, ps->numFrames, ps->internalWaste, pagingFragmentation(ps));
+}
+
+
+/*
+================================================================================
+FUNCTION: freePaging
+================================================================================
+*/
+
+void freePaging(PagingSystem *ps) {
+    for (int i = 0; i < ps->numTables; i++) {
+        free(ps->tables[i].frames);
+    }
+    free(ps->tables);
+    free(ps->frameBitmap);
+    ps->tables = NULL;
+    ps->frameBitmap = NULL;
+    ps->numTables = 0;
+}
+
+
+/*
+================================================================================
+END OF FILE: paging.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. initPaging() - Frame bitmap over the user region
+2. findFreeFrame() - Skip full words, count trailing ones
+3. pagingAllocate() / pagingFree() - Page tables, all-or-nothing
+4. translateAddress() - Logical → physical
+5. pagingFragmentation() / displayPaging() / freePaging()
+================================================================================
+*/
@@ -0,0 +1,239 @@
+/*
+================================================================================
+FILE: quick_lists.c
+PURPOSE: Implement deferred coalescing (exact-size quick lists + sweeps)
+DESCRIPTION:
+    - cacheFreedBlock() parks a freed hole on the list for its size
+    - takeQuickBlock() reuses a parked hole for an identical request
+    - sweepQuickLists() does all the postponed merging in one pass
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/quick_lists.h"
+#include "../include/memory_manager.h"
+
+
+/*
+================================================================================
+FUNCTION: enableDeferredCoalescing
+================================================================================
+*/
+
+int enableDeferredCoalescing(MemoryManager *mm, QuickLists *lists,
+                             int maxCachedSize, int sweepThreshold) {
+
+    if (maxCachedSize < 1) {
+        maxCachedSize = 1;
+    }
+
+    // calloc = malloc + fill with zeros, so every list starts empty (NULL)
+    lists->heads = (MemoryBlock **)calloc(maxCachedSize + 1, sizeof(MemoryBlock *));
+    if (lists->heads == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    lists->maxCachedSize = maxCachedSize;
+    lists->sweepThreshold = (sweepThreshold < 1) ? 1 : sweepThreshold;
+    lists->numCached = 0;
+    lists->hits = 0;
+    lists->misses = 0;
+    lists->sweeps = 0;
+    lists->sweepMerges = 0;
+
+    mm->quickLists = lists;
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: disableDeferredCoalescing
+================================================================================
+*/
+
+void disableDeferredCoalescing(MemoryManager *mm) {
+    QuickLists *lists = mm->quickLists;
+
+    if (lists == NULL) {
+        return;
+    }
+
+    // Merge whatever is waiting so memory looks like eager mode again
+    sweepQuickLists(mm);
+
+    free(lists->heads);
+    lists->heads = NULL;
+    mm->quickLists = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: forgetQuickBlock
+================================================================================
+PURPOSE: Unlink a hole from its quick list (doubly linked → O(1))
+*/
+
+void forgetQuickBlock(MemoryManager *mm, MemoryBlock *block) {
+    QuickLists *lists = mm->quickLists;
+
+    if (lists == NULL || !block->inQuickList) {
+        return;
+    }
+
+    if (block->quickPrev != NULL) {
+        block->quickPrev->quickNext = block->quickNext;
+    } else {
+        lists->heads[block->size] = block->quickNext;
+    }
+    if (block->quickNext != NULL) {
+        block->quickNext->quickPrev = block->quickPrev;
+    }
+
+    block->inQuickList = 0;
+    block->quickPrev = NULL;
+    block->quickNext = NULL;
+    lists->numCached--;
+}
+
+
+/*
+================================================================================
+FUNCTION: takeQuickBlock
+================================================================================
+PURPOSE: Pop a hole of exactly 'size' KB, or NULL (and count a miss)
+*/
+
+MemoryBlock *takeQuickBlock(MemoryManager *mm, int size) {
+    QuickLists *lists = mm->quickLists;
+
+    if (lists == NULL) {
+        return NULL;
+    }
+
+    if (size <= lists->maxCachedSize && lists->heads[size] != NULL) {
+        MemoryBlock *block = lists->heads[size];
+        forgetQuickBlock(mm, block);
+        lists->hits++;
+        return block;
+    }
+
+    lists->misses++;
+    return NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: cacheFreedBlock
+================================================================================
+PURPOSE: Park a just-freed hole instead of merging it
+
+The caller has already turned the block into a hole and updated the
+statistics. Returns 0 if the caller should merge it normally.
+*/
+
+int cacheFreedBlock(MemoryManager *mm, MemoryBlock *block) {
+    QuickLists *lists = mm->quickLists;
+
+    if (lists == NULL || block->size > lists->maxCachedSize) {
+        return 0;
+    }
+
+    // Push on the front of the list for this size
+    block->quickPrev = NULL;
+    block->quickNext = lists->heads[block->size];
+    if (block->quickNext != NULL) {
+        block->quickNext->quickPrev = block;
+    }
+    lists->heads[block->size] = block;
+    block->inQuickList = 1;
+    lists->numCached++;
+
+    // Too many unmerged holes → do the postponed merging now
+    if (lists->numCached >= lists->sweepThreshold) {
+        sweepQuickLists(mm);
+    }
+
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: sweepQuickLists
+================================================================================
+PURPOSE: One pass over memory that merges every run of neighbouring holes
+
+Every hole is taken off its quick list on the way (merged holes change
+size, and the lists must never point at a freed block).
+*/
+
+int sweepQuickLists(MemoryManager *mm) {
+    QuickLists *lists = mm->quickLists;
+    int merges = 0;
+
+    if (lists == NULL) {
+        return 0;
+    }
+
+    // Only holes can merge - follow the hole list
+    MemoryBlock *current = mm->firstHole;
+    while (current != NULL) {
+        forgetQuickBlock(mm, current);
+
+        // Swallow every hole that directly follows this one
+        while (current->next != NULL && current->next->isHole) {
+            mergeWithNext(mm, current);
+            merges++;
+        }
+
+        current = current->nextHole;
+    }
+
+    lists->sweeps++;
+    lists->sweepMerges += merges;
+    return merges;
+}
+
+
+/*
+================================================================================
+FUNCTION: displayQuickListStats
+================================================================================
+*/
+
+void displayQuickListStats(MemoryManager *mm) {
+    QuickLists *lists = mm->quickLists;
+
+    if (lists == NULL) {
+        printf("Deferred coalescing: OFF\n");
+        return;
+    }
+
+    long lookups = lists->hits + lists->misses;
+    double hitRate = (lookups > 0) ? (double)lists->hits / lookups * 100 : 0.0;
+
+    printf("Deferred coalescing: ON (sizes <= %d KB, sweep at %d cached)\n",
+           lists->maxCachedSize, lists->sweepThreshold);
+    printf("Quick list hits: %ld / %ld (%.2f%%)\n", lists->hits, lookups, hitRate);
+    printf("Sweeps: %ld (merged %ld holes) | Cached now: %d\n",
+           lists->sweeps, lists->sweepMerges, lists->numCached);
+}
+
+
+/*
+================================================================================
+END OF FILE: quick_lists.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableDeferredCoalescing() / disableDeferredCoalescing()
+2. cacheFreedBlock() / takeQuickBlock() / forgetQuickBlock()
+3. sweepQuickLists() - Postponed merging in one pass
+4. displayQuickListStats() - Hit rate report
+================================================================================
+*/
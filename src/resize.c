@@ -0,0 +1,172 @@
+/*
+================================================================================
+FILE: resize.c
+PURPOSE: Implement resizeMemory() (in-place shrink/grow, move as last resort)
+DESCRIPTION:
+    Every step is made of the same events as normal allocation
+    (RELEASE, MERGE, SPLIT, BIND), so the event log can replay resizes
+    without knowing about them.
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/resize.h"
+#include "../include/shared_view.h"
+#include "../include/admission_queue.h"
+#include "../include/bitmap_alloc.h"
+
+
+/*
+================================================================================
+FUNCTION: resizeMemory
+================================================================================
+*/
+
+int resizeMemory(MemoryManager *mm, int processID, int newSize) {
+
+    // STEP 1: Validate size
+    if (!requireBlockList(mm, "Resizing")) {
+        return -1;
+    }
+    if (newSize <= 0) {
+        if (isVerbose()) {
+            printf("Error: Invalid process size!\n");
+        }
+        return -1;
+    }
+
+    // STEP 2: Find the process
+    MemoryBlock *block = findProcessBlock(mm, processID);
+    if (block == NULL) {
+        return -1;
+    }
+    if (block->segment != -1) {
+        if (isVerbose()) {
+            printf("Error: P%d is segmented - it has no single size to change!\n", processID);
+        }
+        return -1;
+    }
+
+    int oldSize = block->size;
+    if (newSize == oldSize) {
+        return block->startAddress;
+    }
+
+    // STEP 3: Growing needs that much free memory somewhere
+    if (newSize - oldSize > mm->freeMemory) {
+        if (isVerbose()) {
+            printf("Error: Not enough free memory!\n");
+            printf("Requested: %d KB more, Available: %d KB\n",
+                   newSize - oldSize, mm->freeMemory);
+        }
+        return -1;
+    }
+
+    MemoryBlock *prev = block->prev;
+    MemoryBlock *next = block->next;
+    int nextFree = (next != NULL && next->isHole) ? next->size : 0;
+    int prevFree = (prev != NULL && prev->isHole) ? prev->size : 0;
+    int address;
+    int freedHole = 0;      // Size of a hole that got bigger (0 = none)
+
+    // CASE 1: Shrink in place
+    // [P1: 200 KB] → [P1: 120 KB][HOLE: 80 KB]
+    if (newSize < oldSize) {
+        unbindBlock(mm, block);
+        address = placeProcess(mm, block, processID, newSize);
+
+        // The cut-off tail is a new hole - merge it with a hole after it
+        MemoryBlock *tail = block->next;
+        if (tail->next != NULL && tail->next->isHole) {
+            mergeWithNext(mm, tail);
+        }
+        freedHole = tail->size;
+        mm->resizeStats.resizesInPlace++;
+    }
+
+    // CASE 2: Grow in place into the hole after the process
+    // [P1: 100 KB][HOLE: 80 KB] → [P1: 150 KB][HOLE: 30 KB]
+    else if (oldSize + nextFree >= newSize) {
+        unbindBlock(mm, block);
+        mergeWithNext(mm, block);
+        address = placeProcess(mm, block, processID, newSize);
+        mm->resizeStats.resizesInPlace++;
+    }
+
+    // CASE 3: Slide down into the hole before (plus the hole after)
+    // [HOLE: 60 KB][P1: 100 KB][HOLE: 20 KB] → [P1: 150 KB][HOLE: 30 KB]
+    else if (prevFree + oldSize + nextFree >= newSize) {
+        unbindBlock(mm, block);
+        mergeWithNext(mm, prev);
+        if (nextFree > 0) {
+            mergeWithNext(mm, prev);
+        }
+        address = placeProcess(mm, prev, processID, newSize);
+        if (prev->next != NULL && prev->next->isHole) {
+            freedHole = prev->next->size;
+        }
+
+        // The contents move down (memmove in a real system)
+        mm->resizeStats.resizesMoved++;
+        mm->resizeStats.kbCopied += oldSize;
+    }
+
+    // CASE 4: Relocate - place a new copy elsewhere, then free the old one
+    else {
+        if (newSize > mm->freeMemory) {
+            return -1;      // Only enough space if the old block counted
+        }
+
+        // No swapping or defragmenter step here - either could pick the
+        // old copy (swap it out, or slide it down and free its block)
+        struct SwapSpace *swap = mm->swapSpace;
+        struct Defragmenter *defrag = mm->defragmenter;
+        mm->swapSpace = NULL;
+        mm->defragmenter = NULL;
+        address = allocateMemory(mm, processID, newSize, FIRST_FIT);
+        mm->swapSpace = swap;
+        mm->defragmenter = defrag;
+        if (address == -1) {
+            return -1;
+        }
+
+        MemoryBlock *hole = releaseBlock(mm, block);
+        freedHole = (hole != NULL) ? hole->size : 0;
+
+        mm->resizeStats.resizesMoved++;
+        mm->resizeStats.kbCopied += oldSize;
+    }
+
+    // STEP 4: Space that was given back may let waiting requests in
+    admitPendingRequests(mm, freedHole);
+
+    // STEP 5: Let a live viewer see the change (no-op if none attached)
+    publishSharedView(mm, 0);
+    return address;
+}
+
+
+/*
+================================================================================
+FUNCTION: displayResizeStats
+================================================================================
+*/
+
+void displayResizeStats(MemoryManager *mm) {
+    printf("Resizes: %ld in place, %ld moved (%ld KB copied)\n",
+           mm->resizeStats.resizesInPlace, mm->resizeStats.resizesMoved,
+           mm->resizeStats.kbCopied);
+}
+
+
+/*
+================================================================================
+END OF FILE: resize.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. resizeMemory() - Shrink / grow in place, slide down, or relocate
+2. displayResizeStats() - In-place vs moved counts and KB copied
+================================================================================
+*/
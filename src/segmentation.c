@@ -0,0 +1,375 @@
+/*
+================================================================================
+FILE: segmentation.c
+PURPOSE: Implement segment tables and all-or-nothing segment groups
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/segmentation.h"
+#include "../include/admission_queue.h"
+#include "../include/shared_view.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/block_index.h"
+
+
+/*
+================================================================================
+TABLE HASH (internal helpers)
+================================================================================
+*/
+
+static unsigned int bucketOf(SegmentManager *sm, int processID) {
+    return ((unsigned int)processID * 2654435761u) & (sm->numBuckets - 1);
+}
+
+static void insertTable(SegmentManager *sm, SegmentTable *table) {
+    unsigned int b = bucketOf(sm, table->processID);
+    table->next = sm->buckets[b];
+    sm->buckets[b] = table;
+    sm->numTables++;
+}
+
+// Double the bucket array when it holds more tables than buckets
+static void growBuckets(SegmentManager *sm) {
+    int oldCount = sm->numBuckets;
+    SegmentTable **old = sm->buckets;
+    SegmentTable **bigger = (SegmentTable **)calloc(oldCount * 2, sizeof(SegmentTable *));
+
+    if (bigger == NULL) {
+        return;         // Keep the old buckets - just longer chains
+    }
+
+    sm->buckets = bigger;
+    sm->numBuckets = oldCount * 2;
+    sm->numTables = 0;
+    for (int b = 0; b < oldCount; b++) {
+        SegmentTable *table = old[b];
+        while (table != NULL) {
+            SegmentTable *following = table->next;
+            insertTable(sm, table);
+            table = following;
+        }
+    }
+    free(old);
+}
+
+// Unlink the table of 'processID' and return it (NULL if none)
+static SegmentTable *unlinkTable(SegmentManager *sm, int processID) {
+    SegmentTable **link = &sm->buckets[bucketOf(sm, processID)];
+    while (*link != NULL && (*link)->processID != processID) {
+        link = &(*link)->next;
+    }
+
+    SegmentTable *table = *link;
+    if (table != NULL) {
+        *link = table->next;
+        sm->numTables--;
+    }
+    return table;
+}
+
+
+/*
+================================================================================
+FUNCTION: enableSegmentation / disableSegmentation
+================================================================================
+*/
+
+int enableSegmentation(MemoryManager *mm, SegmentManager *sm) {
+    if (!requireBlockList(mm, "Segmentation")) {
+        return 0;
+    }
+
+    sm->numBuckets = 64;
+    sm->numTables = 0;
+    sm->buckets = (SegmentTable **)calloc(sm->numBuckets, sizeof(SegmentTable *));
+    if (sm->buckets == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    // Duplicate checks need the PID table, finding placed blocks the address index
+    sm->ownsIndex = 0;
+    sm->ownsAddresses = 0;
+    if (mm->blockIndex == NULL) {
+        if (!enableBlockIndex(mm, &sm->index)) {
+            free(sm->buckets);
+            sm->buckets = NULL;
+            return 0;
+        }
+        sm->ownsIndex = 1;
+    }
+    if (mm->addressIndex == NULL) {
+        enableAddressIndex(mm, &sm->addresses);
+        sm->ownsAddresses = 1;
+    }
+
+    mm->segments = sm;
+    return 1;
+}
+
+void disableSegmentation(MemoryManager *mm) {
+    SegmentManager *sm = mm->segments;
+
+    if (sm == NULL) {
+        return;
+    }
+
+    for (int b = 0; b < sm->numBuckets; b++) {
+        SegmentTable *table = sm->buckets[b];
+        while (table != NULL) {
+            SegmentTable *following = table->next;
+            for (int s = 0; s < table->numSegments; s++) {
+                table->segments[s].block->segment = -1;
+                indexProcessPinned(mm, table->segments[s].block, 0);
+            }
+            free(table);
+            table = following;
+        }
+    }
+    free(sm->buckets);
+    sm->buckets = NULL;
+    sm->numTables = 0;
+    mm->segments = NULL;
+
+    if (sm->ownsIndex) {
+        disableBlockIndex(mm);
+    }
+    if (sm->ownsAddresses) {
+        disableAddressIndex(mm);
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: findSegmentTable
+================================================================================
+*/
+
+SegmentTable *findSegmentTable(MemoryManager *mm, int processID) {
+    if (mm->segments == NULL) {
+        return NULL;
+    }
+
+    SegmentTable *table = mm->segments->buckets[bucketOf(mm->segments, processID)];
+    while (table != NULL && table->processID != processID) {
+        table = table->next;
+    }
+    return table;
+}
+
+
+/*
+================================================================================
+FUNCTION: allocateSegments
+================================================================================
+*/
+
+int allocateSegments(MemoryManager *mm, int processID, const int sizes[],
+                     const char *names[], int n, AllocationAlgorithm algo) {
+
+    // STEP 1: Validate
+    if (mm->segments == NULL) {
+        if (isVerbose()) {
+            printf("Error: Segmentation is not enabled!\n");
+        }
+        return -1;
+    }
+    if (!requireBlockList(mm, "Segmentation")) {
+        return -1;
+    }
+    if (n <= 0 || n > MAX_SEGMENTS) {
+        if (isVerbose()) {
+            printf("Error: A process can have 1 to %d segments!\n", MAX_SEGMENTS);
+        }
+        return -1;
+    }
+    if (findSegmentTable(mm, processID) != NULL || findProcessBlock(mm, processID) != NULL) {
+        if (isVerbose()) {
+            printf("Error: P%d is already in memory!\n", processID);
+        }
+        return -1;
+    }
+
+    long total = 0;
+    for (int i = 0; i < n; i++) {
+        if (sizes[i] <= 0) {
+            if (isVerbose()) {
+                printf("Error: Invalid process size!\n");
+            }
+            return -1;
+        }
+        total += sizes[i];
+    }
+    if (total > mm->freeMemory && mm->swapSpace == NULL) {
+        if (isVerbose()) {
+            printf("Error: Not enough free memory!\n");
+            printf("Requested: %ld KB, Available: %d KB\n", total, mm->freeMemory);
+        }
+        return -1;
+    }
+
+    SegmentTable *table = (SegmentTable *)malloc(sizeof(SegmentTable));
+    if (table == NULL) {
+        if (isVerbose()) {
+            printf("Error: Memory allocation failed!\n");
+        }
+        return -1;
+    }
+    table->processID = processID;
+    table->numSegments = n;
+
+    // STEP 2: Largest first (simple selection order, n is at most 8)
+    int order[MAX_SEGMENTS];
+    for (int i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            if (sizes[order[j]] > sizes[order[i]]) {
+                int swap = order[i];
+                order[i] = order[j];
+                order[j] = swap;
+            }
+        }
+    }
+
+    // STEP 3: Place each segment with the chosen fit algorithm
+    int placed;
+    for (placed = 0; placed < n; placed++) {
+        int s = order[placed];
+        int address = allocateMemory(mm, processID, sizes[s], algo);
+        if (address == -1) {
+            break;
+        }
+        Segment *segment = &table->segments[s];
+        segment->block = findBlockAt(mm, address);
+        segment->block->segment = s;
+        indexProcessPinned(mm, segment->block, 1);     // Segments never swap
+        if (names != NULL && names[s] != NULL) {
+            strncpy(segment->name, names[s], SEGMENT_NAME_LENGTH - 1);
+            segment->name[SEGMENT_NAME_LENGTH - 1] = '\0';
+        } else {
+            snprintf(segment->name, SEGMENT_NAME_LENGTH, "S%d", s);
+        }
+    }
+
+    // STEP 4: One failed → undo the ones already placed (all or nothing)
+    if (placed < n) {
+        for (int i = 0; i < placed; i++) {
+            releaseBlock(mm, table->segments[order[i]].block);
+        }
+        free(table);
+        publishSharedView(mm, 0);
+        return -1;
+    }
+
+    // STEP 5: Remember the table
+    if (mm->segments->numTables >= mm->segments->numBuckets) {
+        growBuckets(mm->segments);
+    }
+    insertTable(mm->segments, table);
+    return n;
+}
+
+
+/*
+================================================================================
+FUNCTION: deallocateSegments
+================================================================================
+*/
+
+int deallocateSegments(MemoryManager *mm, int processID) {
+    if (mm->segments == NULL) {
+        return 0;
+    }
+
+    // STEP 1: One hash lookup gives every block of the process
+    SegmentTable *table = unlinkTable(mm->segments, processID);
+    if (table == NULL) {
+        return 0;
+    }
+
+    // STEP 2: Release each segment (merges with neighbouring holes;
+    // only holes are ever freed by a merge, so the other segment
+    // blocks in the table stay valid)
+    for (int s = 0; s < table->numSegments; s++) {
+        releaseBlock(mm, table->segments[s].block);
+    }
+    free(table);
+
+    // STEP 3: Several holes grew - waiting requests look for the largest
+    admitPendingRequests(mm, -1);
+    publishSharedView(mm, 0);
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: translateSegmentAddress / forgetSegmentTable
+================================================================================
+*/
+
+int translateSegmentAddress(MemoryManager *mm, int processID, int segment, int offset) {
+    SegmentTable *table = findSegmentTable(mm, processID);
+
+    if (table == NULL || segment < 0 || segment >= table->numSegments) {
+        return -1;
+    }
+
+    MemoryBlock *block = table->segments[segment].block;
+    if (offset < 0 || offset >= block->size) {
+        return -1;      // Past the limit: segmentation fault
+    }
+    return block->startAddress + offset;
+}
+
+void forgetSegmentTable(MemoryManager *mm, int processID) {
+    if (mm->segments != NULL) {
+        free(unlinkTable(mm->segments, processID));
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: displaySegmentTable
+================================================================================
+*/
+
+void displaySegmentTable(MemoryManager *mm, int processID) {
+    SegmentTable *table = findSegmentTable(mm, processID);
+
+    if (table == NULL) {
+        printf("P%d has no segment table.\n", processID);
+        return;
+    }
+
+    printf("Segment table of P%d:\n", processID);
+    printf("  Seg  Name      Base   Limit\n");
+    for (int s = 0; s < table->numSegments; s++) {
+        MemoryBlock *block = table->segments[s].block;
+        printf("  %-4d %-9s %-6d %d KB\n", s, table->segments[s].name,
+               block->startAddress, block->size);
+    }
+}
+
+
+/*
+================================================================================
+END OF FILE: segmentation.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableSegmentation() / disableSegmentation()
+2. allocateSegments() - Largest first, undo everything on failure
+3. deallocateSegments() - One lookup, release every segment
+4. findSegmentTable() / translateSegmentAddress() / forgetSegmentTable()
+5. displaySegmentTable()
+================================================================================
+*/
@@ -0,0 +1,340 @@
+/*
+================================================================================
+FILE: shared_view.c
+PURPOSE: Implement the shared-memory mirror of the block table
+DESCRIPTION:
+    - Writer: createSharedView() + attachSharedView(), then the memory
+      manager calls publishSharedView() after every change
+    - Reader: openSharedView() + readSharedView() in a separate process
+    - Uses POSIX shm_open/mmap (Linux, macOS). On Windows and in the
+      WebAssembly build every function reports "not supported" so the
+      rest of the program still builds.
+      Older Linux systems may need -lrt when linking.
+================================================================================
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "../include/shared_view.h"
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/*
+================================================================================
+STRUCTURE: SharedViewSegment
+================================================================================
+PURPOSE: The exact bytes that live in shared memory
+
+blocks[] is a "flexible array member": the segment is created big enough
+for 'capacity' blocks right after the header.
+*/
+
+struct SharedViewSegment {
+    unsigned int magic;
+    unsigned int version;
+    atomic_uint sequence;       // The seqlock counter (odd = writing)
+    int capacity;
+    SharedViewStats stats;
+    SharedBlock blocks[];
+};
+
+
+/*
+================================================================================
+FUNCTION: createSharedView
+================================================================================
+*/
+
+int createSharedView(SharedView *view, const char *name, int capacity,
+                     int publishEvery) {
+
+    memset(view, 0, sizeof(SharedView));
+    view->fd = -1;
+
+    if (capacity < 1) {
+        capacity = 1;
+    }
+
+    // STEP 1: Create the named segment (replace an old one with this name)
+    snprintf(view->name, sizeof(view->name), "%s", name);
+    shm_unlink(view->name);
+    view->fd = shm_open(view->name, O_CREAT | O_RDWR, 0644);
+    if (view->fd < 0) {
+        perror("Error: shm_open failed");
+        return 0;
+    }
+
+    // STEP 2: Make it big enough for the header plus 'capacity' blocks
+    view->bytes = sizeof(struct SharedViewSegment) +
+                  (size_t)capacity * sizeof(SharedBlock);
+    if (ftruncate(view->fd, (off_t)view->bytes) != 0) {
+        perror("Error: ftruncate on shared segment failed");
+        close(view->fd);
+        shm_unlink(view->name);
+        return 0;
+    }
+
+    // STEP 3: Map it into our address space
+    void *mapping = mmap(NULL, view->bytes, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, view->fd, 0);
+    if (mapping == MAP_FAILED) {
+        perror("Error: mmap of shared segment failed");
+        close(view->fd);
+        shm_unlink(view->name);
+        return 0;
+    }
+
+    // STEP 4: Fill in the header; readers check magic before trusting it
+    view->segment = (struct SharedViewSegment *)mapping;
+    view->segment->version = SHARED_VIEW_VERSION;
+    view->segment->capacity = capacity;
+    atomic_init(&view->segment->sequence, 0);
+    atomic_thread_fence(memory_order_release);
+    view->segment->magic = SHARED_VIEW_MAGIC;
+
+    view->isWriter = 1;
+    view->publishEvery = (publishEvery < 1) ? 1 : publishEvery;
+    view->opsSincePublish = 0;
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: attachSharedView
+================================================================================
+*/
+
+void attachSharedView(MemoryManager *mm, SharedView *view) {
+    mm->sharedView = view;
+    if (view != NULL) {
+        publishSharedView(mm, 1);
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: publishSharedView
+================================================================================
+PURPOSE: Writer half of the seqlock - copy blocks between two increments
+*/
+
+void publishSharedView(MemoryManager *mm, int force) {
+    SharedView *view = mm->sharedView;
+
+    if (view == NULL || view->segment == NULL) {
+        return;
+    }
+
+    // Throttle: only every N-th change is mirrored unless forced
+    view->opsSincePublish++;
+    if (!force && view->opsSincePublish < view->publishEvery) {
+        return;
+    }
+    view->opsSincePublish = 0;
+
+    struct SharedViewSegment *segment = view->segment;
+    unsigned int seq = atomic_load_explicit(&segment->sequence, memory_order_relaxed);
+
+    // STEP 1: Odd sequence = "writing in progress"
+    atomic_store_explicit(&segment->sequence, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    // STEP 2: Copy the block table (plain stores, no formatting)
+    int copied = 0;
+    int total = 0;
+    MemoryBlock *current = mm->head;
+    while (current != NULL) {
+        if (copied < segment->capacity) {
+            SharedBlock *out = &segment->blocks[copied++];
+            out->startAddress = current->startAddress;
+            out->size = current->size;
+            out->processID = current->isHole ? -1 : current->processID;
+        }
+        total++;
+        current = current->next;
+    }
+
+    segment->stats.totalMemory = mm->totalMemory;
+    segment->stats.osMemory = mm->osMemory;
+    segment->stats.freeMemory = mm->freeMemory;
+    segment->stats.numProcesses = mm->numProcesses;
+    segment->stats.numHoles = mm->numHoles;
+    segment->stats.numBlocks = copied;
+    segment->stats.totalBlocks = total;
+    segment->stats.publishCount++;
+
+    // STEP 3: Even sequence = "data is complete"
+    atomic_store_explicit(&segment->sequence, seq + 2, memory_order_release);
+}
+
+
+/*
+================================================================================
+FUNCTION: openSharedView
+================================================================================
+*/
+
+int openSharedView(SharedView *view, const char *name) {
+
+    memset(view, 0, sizeof(SharedView));
+    snprintf(view->name, sizeof(view->name), "%s", name);
+
+    view->fd = shm_open(view->name, O_RDONLY, 0);
+    if (view->fd < 0) {
+        return 0;
+    }
+
+    // The segment size tells us the capacity the writer chose
+    struct stat info;
+    if (fstat(view->fd, &info) != 0 ||
+        (size_t)info.st_size < sizeof(struct SharedViewSegment)) {
+        close(view->fd);
+        return 0;
+    }
+    view->bytes = (size_t)info.st_size;
+
+    void *mapping = mmap(NULL, view->bytes, PROT_READ, MAP_SHARED, view->fd, 0);
+    if (mapping == MAP_FAILED) {
+        close(view->fd);
+        return 0;
+    }
+
+    view->segment = (struct SharedViewSegment *)mapping;
+    if (view->segment->magic != SHARED_VIEW_MAGIC ||
+        view->segment->version != SHARED_VIEW_VERSION) {
+        closeSharedView(view);
+        return 0;
+    }
+
+    view->isWriter = 0;
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: readSharedView
+================================================================================
+PURPOSE: Reader half of the seqlock - copy, then check nothing changed
+*/
+
+int readSharedView(SharedView *view, SharedBlock *out, int maxBlocks,
+                   SharedViewStats *stats) {
+
+    struct SharedViewSegment *segment = view->segment;
+    int retries = 0;
+
+    while (1) {
+        // STEP 1: Wait until the writer is not in the middle of a copy
+        unsigned int s1 = atomic_load_explicit(&segment->sequence, memory_order_acquire);
+        if (s1 & 1u) {
+            retries++;
+            continue;
+        }
+
+        // STEP 2: Copy counters and blocks
+        *stats = segment->stats;
+        int count = stats->numBlocks;
+        if (count > maxBlocks) {
+            count = maxBlocks;
+        }
+        if (count > segment->capacity) {
+            count = segment->capacity;
+        }
+        if (count < 0) {
+            count = 0;
+        }
+        memcpy(out, segment->blocks, (size_t)count * sizeof(SharedBlock));
+
+        // STEP 3: If the sequence did not move, the copy is consistent
+        atomic_thread_fence(memory_order_acquire);
+        unsigned int s2 = atomic_load_explicit(&segment->sequence, memory_order_relaxed);
+        if (s1 == s2) {
+            stats->numBlocks = count;
+            return retries;
+        }
+        retries++;
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: closeSharedView
+================================================================================
+*/
+
+void closeSharedView(SharedView *view) {
+    if (view->segment != NULL) {
+        munmap(view->segment, view->bytes);
+        view->segment = NULL;
+    }
+    if (view->fd >= 0) {
+        close(view->fd);
+        view->fd = -1;
+    }
+    if (view->isWriter) {
+        shm_unlink(view->name);
+    }
+}
+
+
+#else   /* Windows / WebAssembly: POSIX shared memory is not available */
+
+int createSharedView(SharedView *view, const char *name, int capacity,
+                     int publishEvery) {
+    (void)name; (void)capacity; (void)publishEvery;
+    memset(view, 0, sizeof(SharedView));
+    printf("Error: Shared memory view is not supported on this platform.\n");
+    return 0;
+}
+
+void attachSharedView(MemoryManager *mm, SharedView *view) {
+    (void)view;
+    mm->sharedView = NULL;
+}
+
+void publishSharedView(MemoryManager *mm, int force) {
+    (void)mm; (void)force;
+}
+
+int openSharedView(SharedView *view, const char *name) {
+    (void)name;
+    memset(view, 0, sizeof(SharedView));
+    return 0;
+}
+
+int readSharedView(SharedView *view, SharedBlock *out, int maxBlocks,
+                   SharedViewStats *stats) {
+    (void)view; (void)out; (void)maxBlocks;
+    memset(stats, 0, sizeof(SharedViewStats));
+    return 0;
+}
+
+void closeSharedView(SharedView *view) {
+    (void)view;
+}
+
+#endif
+
+
+/*
+================================================================================
+END OF FILE: shared_view.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. createSharedView() / attachSharedView() - Writer setup
+2. publishSharedView() - Seqlock write (called by memory_manager.c)
+3. openSharedView() / readSharedView() - Seqlock read for viewers
+4. closeSharedView() - Unmap and clean up
+================================================================================
+*/
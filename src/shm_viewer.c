@@ -0,0 +1,124 @@
+/*
+================================================================================
+FILE: shm_viewer.c
+PURPOSE: Separate viewer program for a running simulation
+DESCRIPTION:
+    - Maps the shared segment published by the simulator (shared_view.c)
+    - Redraws memory ~60 times per second without slowing the simulator
+    - The simulator never waits for us: if we catch it mid-update, the
+      seqlock tells us and we simply read again
+
+HOW TO RUN (two terminals):
+    MAV_SHARED_VIEW=/mav_view ./build/memory_visualizer
+    ./build/shm_viewer /mav_view
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/shared_view.h"
+
+// Width of the memory bar in characters
+#define VIEW_COLUMNS 64
+
+// ~60 frames per second
+#define FRAME_NANOSECONDS 16666667L
+
+
+/*
+================================================================================
+FUNCTION: drawFrame
+================================================================================
+PURPOSE: Draw one proportional bar of memory
+
+Each column covers (userMemory / VIEW_COLUMNS) KB:
+    '#' = mostly used    '+' = partly used    '.' = free
+*/
+
+static void drawFrame(SharedBlock *blocks, SharedViewStats *stats, int retries) {
+    int userMemory = stats->totalMemory - stats->osMemory;
+    double used[VIEW_COLUMNS] = {0};
+
+    if (userMemory <= 0) {
+        return;
+    }
+
+    // STEP 1: Add every process block's KB to the columns it covers
+    double kbPerColumn = (double)userMemory / VIEW_COLUMNS;
+    for (int i = 0; i < stats->numBlocks; i++) {
+        if (blocks[i].processID == -1) {
+            continue;
+        }
+        double start = blocks[i].startAddress - stats->osMemory;
+        double end = start + blocks[i].size;
+        int first = (int)(start / kbPerColumn);
+        int last = (int)((end - 1) / kbPerColumn);
+        for (int c = first; c <= last && c < VIEW_COLUMNS; c++) {
+            double colStart = c * kbPerColumn;
+            double colEnd = colStart + kbPerColumn;
+            double overlapStart = (start > colStart) ? start : colStart;
+            double overlapEnd = (end < colEnd) ? end : colEnd;
+            used[c] += overlapEnd - overlapStart;
+        }
+    }
+
+    // STEP 2: Clear the screen (ANSI escape) and print
+    printf("\033[H\033[2J");
+    printf("MEMORY (live)  publish #%u  retries %d\n\n",
+           stats->publishCount, retries);
+    printf("[OS]");
+    for (int c = 0; c < VIEW_COLUMNS; c++) {
+        double fraction = used[c] / kbPerColumn;
+        putchar(fraction > 0.75 ? '#' : (fraction > 0.0 ? '+' : '.'));
+    }
+    printf("\n\n");
+    printf("Free Memory: %d KB of %d KB\n", stats->freeMemory, userMemory);
+    printf("Processes: %d | Holes: %d | Blocks: %d",
+           stats->numProcesses, stats->numHoles, stats->totalBlocks);
+    if (stats->totalBlocks > stats->numBlocks) {
+        printf(" (showing first %d)", stats->numBlocks);
+    }
+    printf("\n\nLegend: #=used  +=partly used  .=free   (Ctrl+C to quit)\n");
+    fflush(stdout);
+}
+
+
+/*
+================================================================================
+FUNCTION: main
+================================================================================
+*/
+
+int main(int argc, char *argv[]) {
+    const char *name = (argc > 1) ? argv[1] : "/mav_view";
+    SharedView view;
+
+    if (!openSharedView(&view, name)) {
+        printf("Could not open shared view '%s'.\n", name);
+        printf("Start the simulator with MAV_SHARED_VIEW=%s first.\n", name);
+        return 1;
+    }
+
+    // Room for every block the writer can publish
+    int capacity = (int)((view.bytes - sizeof(SharedViewStats)) / sizeof(SharedBlock));
+    SharedBlock *blocks = (SharedBlock *)malloc(sizeof(SharedBlock) * capacity);
+    if (blocks == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        closeSharedView(&view);
+        return 1;
+    }
+
+    struct timespec frame = {0, FRAME_NANOSECONDS};
+    while (1) {
+        SharedViewStats stats;
+        int retries = readSharedView(&view, blocks, capacity, &stats);
+        drawFrame(blocks, &stats, retries);
+        nanosleep(&frame, NULL);
+    }
+
+    // Not reached (Ctrl+C ends the program), kept for completeness
+    free(blocks);
+    closeSharedView(&view);
+    return 0;
+}
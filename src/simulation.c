@@ -0,0 +1,388 @@
+/*
+================================================================================
+FILE: simulation.c
+PURPOSE: Implement the discrete-event simulation engine
+DESCRIPTION:
+    - A binary min-heap of arrival/departure events drives the clock
+    - Arrivals call allocateMemory() (or submitRequest() when an
+      admission queue is attached), departures call deallocateMemory()
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/simulation.h"
+#include "../include/admission_queue.h"
+#include "../include/defrag.h"
+
+// Sample fragmentation every this many events (it walks all blocks)
+#define DEFAULT_SAMPLE_INTERVAL 1000
+
+
+/*
+================================================================================
+RANDOM NUMBERS (internal helpers)
+================================================================================
+xorshift32: tiny, fast, and the same sequence on every system for a
+given seed. naturalLog() avoids linking the math library, so the
+compile command stays the same.
+*/
+
+static unsigned int nextRandom(unsigned int *state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// Uniform in (0, 1]
+static double randomUnit(unsigned int *state) {
+    return ((nextRandom(state) >> 8) + 1.0) / 16777216.0;
+}
+
+// ln(x) for 0 < x <= 1: scale into [0.5, 1), then the atanh series
+static double naturalLog(double x) {
+    const double LN2 = 0.69314718055994530942;
+    int halvings = 0;
+    while (x < 0.5) {
+        x *= 2.0;
+        halvings++;
+    }
+
+    double z = (x - 1.0) / (x + 1.0);      // |z| <= 1/3
+    double z2 = z * z;
+    double term = z;
+    double sum = 0.0;
+    for (int k = 1; k < 40; k += 2) {
+        sum += term / k;
+        term *= z2;
+    }
+    return 2.0 * sum - halvings * LN2;
+}
+
+static double randomExponential(unsigned int *state, double mean) {
+    return -mean * naturalLog(randomUnit(state));
+}
+
+
+/*
+================================================================================
+FUNCTION: generateWorkload
+================================================================================
+*/
+
+void generateWorkload(SimProcess processes[], int n, unsigned int seed,
+                      double meanInterarrival, double meanDuration,
+                      int minSize, int maxSize) {
+    unsigned int state = (seed != 0) ? seed : 1;    // xorshift needs != 0
+    double t = 0.0;
+
+    for (int i = 0; i < n; i++) {
+        t += randomExponential(&state, meanInterarrival);
+        processes[i].processID = i + 1;
+        processes[i].arrivalTime = t;
+        processes[i].size = minSize + (int)(nextRandom(&state) % (maxSize - minSize + 1));
+        processes[i].duration = randomExponential(&state, meanDuration);
+    }
+}
+
+
+/*
+================================================================================
+EVENT HEAP (internal helpers)
+================================================================================
+heap[0] is the earliest event. Children of i are 2i+1 and 2i+2.
+*/
+
+static int eventBefore(const SimEvent *a, const SimEvent *b) {
+    if (a->time != b->time) {
+        return a->time < b->time;
+    }
+    return a->type < b->type;       // Departures first at equal times
+}
+
+static int pushEvent(Simulation *sim, double time, SimEventType type, int index) {
+    if (sim->heapSize == sim->heapCapacity) {
+        int newCapacity = sim->heapCapacity * 2;
+        SimEvent *bigger = (SimEvent *)realloc(sim->heap, sizeof(SimEvent) * newCapacity);
+        if (bigger == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return 0;
+        }
+        sim->heap = bigger;
+        sim->heapCapacity = newCapacity;
+    }
+
+    // Sift up: move parents down until the new event's spot is found
+    SimEvent event = {time, type, index};
+    int i = sim->heapSize++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!eventBefore(&event, &sim->heap[parent])) {
+            break;
+        }
+        sim->heap[i] = sim->heap[parent];
+        i = parent;
+    }
+    sim->heap[i] = event;
+    return 1;
+}
+
+static SimEvent popEvent(Simulation *sim) {
+    SimEvent top = sim->heap[0];
+    SimEvent last = sim->heap[--sim->heapSize];
+
+    // Sift down: move the smaller child up until 'last' fits
+    int i = 0;
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= sim->heapSize) {
+            break;
+        }
+        if (child + 1 < sim->heapSize &&
+            eventBefore(&sim->heap[child + 1], &sim->heap[child])) {
+            child++;
+        }
+        if (!eventBefore(&sim->heap[child], &last)) {
+            break;
+        }
+        sim->heap[i] = sim->heap[child];
+        i = child;
+    }
+    if (sim->heapSize > 0) {
+        sim->heap[i] = last;
+    }
+    return top;
+}
+
+
+/*
+================================================================================
+FUNCTION: onAdmitted (admission queue callback)
+================================================================================
+PURPOSE: A waiting process finally got memory - schedule its departure
+*/
+
+static void onAdmitted(void *context, int processID) {
+    Simulation *sim = (Simulation *)context;
+    int index = processID - 1;
+
+    if (index < 0 || index >= sim->numProcesses) {
+        return;         // Not one of ours
+    }
+    sim->admittedLate++;
+    pushEvent(sim, sim->now + sim->processes[index].duration, SIM_DEPARTURE, index);
+}
+
+
+/*
+================================================================================
+FUNCTION: initSimulation
+================================================================================
+*/
+
+static int compareArrivals(const void *a, const void *b) {
+    const SimProcess *x = (const SimProcess *)a;
+    const SimProcess *y = (const SimProcess *)b;
+    return (x->arrivalTime < y->arrivalTime) ? -1 : (x->arrivalTime > y->arrivalTime);
+}
+
+int initSimulation(Simulation *sim, MemoryManager *mm, SimProcess processes[],
+                   int n, AllocationAlgorithm algo) {
+
+    // STEP 1: Sort by arrival and number the processes 1..n
+    qsort(processes, n, sizeof(SimProcess), compareArrivals);
+    for (int i = 0; i < n; i++) {
+        processes[i].processID = i + 1;
+    }
+
+    sim->mm = mm;
+    sim->algo = algo;
+    sim->processes = processes;
+    sim->numProcesses = n;
+    sim->nextArrival = 0;
+    sim->now = 0.0;
+    sim->eventsProcessed = 0;
+    sim->allocated = 0;
+    sim->admittedLate = 0;
+    sim->rejected = 0;
+    sim->sampleInterval = DEFAULT_SAMPLE_INTERVAL;
+    sim->fragmentationSamples = 0;
+    sim->fragmentationSum = 0.0;
+    sim->cpuSeconds = 0.0;
+    sim->stream = NULL;
+
+    // STEP 2: Empty heap (grows when needed)
+    sim->heapCapacity = 1024;
+    sim->heapSize = 0;
+    sim->heap = (SimEvent *)malloc(sizeof(SimEvent) * sim->heapCapacity);
+    if (sim->heap == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    // STEP 3: Waiting processes depart 'duration' after admission
+    if (mm->admissionQueue != NULL) {
+        mm->admissionQueue->onAdmit = onAdmitted;
+        mm->admissionQueue->onAdmitContext = sim;
+    }
+
+    // STEP 4: Only the first arrival goes in; each arrival adds the next
+    if (n > 0) {
+        pushEvent(sim, processes[0].arrivalTime, SIM_ARRIVAL, 0);
+        sim->nextArrival = 1;
+    }
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: handleArrival (internal helper)
+================================================================================
+RETURNS: Start address, or -1 if the process was rejected or is waiting
+*/
+
+static int handleArrival(Simulation *sim, int index) {
+    MemoryManager *mm = sim->mm;
+    SimProcess *p = &sim->processes[index];
+    int address;
+
+    // Schedule the next arrival first (keeps the heap small)
+    if (sim->nextArrival < sim->numProcesses) {
+        pushEvent(sim, sim->processes[sim->nextArrival].arrivalTime,
+                  SIM_ARRIVAL, sim->nextArrival);
+        sim->nextArrival++;
+    }
+
+    if (mm->admissionQueue != NULL) {
+        int waitingBefore = mm->admissionQueue->numPending;
+        address = submitRequest(mm, p->processID, p->size, 0, sim->algo);
+        if (address == -1 && mm->admissionQueue->numPending > waitingBefore) {
+            return -1;  // Waiting - onAdmitted() schedules the departure
+        }
+    } else if (p->size > mm->freeMemory) {
+        address = -1;   // Skip allocateMemory()'s error message
+    } else {
+        address = allocateMemory(mm, p->processID, p->size, sim->algo);
+    }
+
+    if (address == -1) {
+        sim->rejected++;
+        return -1;
+    }
+
+    sim->allocated++;
+    pushEvent(sim, sim->now + p->duration, SIM_DEPARTURE, index);
+    return address;
+}
+
+
+/*
+================================================================================
+FUNCTION: runSimulation
+================================================================================
+*/
+
+long runSimulation(Simulation *sim, double untilTime) {
+    long processed = 0;
+    clock_t start = clock();
+
+    while (sim->heapSize > 0) {
+
+        // STEP 1: Stop before the first event past 'untilTime'
+        if (untilTime >= 0 && sim->heap[0].time > untilTime) {
+            sim->now = untilTime;
+            break;
+        }
+
+        // STEP 2: Jump the clock to the next event
+        SimEvent event = popEvent(sim);
+        sim->now = event.time;
+        setAdmissionTime(sim->mm, sim->now);
+        defragAdvanceClock(sim->mm, sim->now);
+
+        // STEP 3: Apply it
+        SimProcess *p = &sim->processes[event.index];
+        int address = -1;
+        int ok;
+        if (event.type == SIM_ARRIVAL) {
+            address = handleArrival(sim, event.index);
+            ok = (address != -1);
+        } else {
+            ok = deallocateMemory(sim->mm, p->processID);
+        }
+        if (sim->stream != NULL) {
+            StreamEvent record = {sim->eventsProcessed + 1, sim->now,
+                                  (event.type == SIM_ARRIVAL) ? "arrive" : "depart",
+                                  p->processID, p->size, address, NULL, ok};
+            streamEvent(sim->stream, sim->mm, &record);
+        }
+
+        // STEP 4: Sample fragmentation now and then
+        processed++;
+        sim->eventsProcessed++;
+        if (sim->eventsProcessed % sim->sampleInterval == 0) {
+            sim->fragmentationSum += calculateFragmentation(sim->mm);
+            sim->fragmentationSamples++;
+        }
+    }
+
+    sim->cpuSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+    return processed;
+}
+
+
+/*
+================================================================================
+FUNCTION: displaySimulationStats
+================================================================================
+*/
+
+void displaySimulationStats(Simulation *sim) {
+    double rate = (sim->cpuSeconds > 0) ? sim->eventsProcessed / sim->cpuSeconds : 0.0;
+    double average = (sim->fragmentationSamples > 0) ?
+                     sim->fragmentationSum / sim->fragmentationSamples : 0.0;
+
+    printf("Simulated time: %.2f | Events: %ld (%.1f million/s)\n",
+           sim->now, sim->eventsProcessed, rate / 1e6);
+    printf("Allocated: %ld | Admitted after waiting: %ld | Rejected: %ld\n",
+           sim->allocated, sim->admittedLate, sim->rejected);
+    printf("Average fragmentation: %.2f%% | Now: %.2f%%\n",
+           average, calculateFragmentation(sim->mm));
+}
+
+
+/*
+================================================================================
+FUNCTION: freeSimulation
+================================================================================
+*/
+
+void freeSimulation(Simulation *sim) {
+    if (sim->mm->admissionQueue != NULL &&
+        sim->mm->admissionQueue->onAdmitContext == sim) {
+        sim->mm->admissionQueue->onAdmit = NULL;
+        sim->mm->admissionQueue->onAdmitContext = NULL;
+    }
+    free(sim->heap);
+    sim->heap = NULL;
+    sim->heapSize = 0;
+}
+
+
+/*
+================================================================================
+END OF FILE: simulation.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. generateWorkload() - Reproducible exponential arrivals/durations
+2. pushEvent() / popEvent() - Binary min-heap of events
+3. initSimulation() / runSimulation() - The event loop
+4. displaySimulationStats() / freeSimulation()
+================================================================================
+*/
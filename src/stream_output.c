@@ -0,0 +1,374 @@
+/*
+================================================================================
+FILE: stream_output.c
+PURPOSE: Implement the buffered NDJSON / CSV record writer
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/stream_output.h"
+#include "../include/block_index.h"
+#include "../include/compact_blocks.h"
+
+
+/*
+================================================================================
+BUFFER HELPERS (internal)
+================================================================================
+Numbers are turned into digits here instead of by printf(): printf()
+parses its format string on every call, which costs more than the
+allocation the record describes. Strings written here are our own
+words ("alloc", "bad_command", ...), so nothing needs escaping.
+*/
+
+// Make room for n more bytes - the only place the buffer is written out
+static void reserve(StreamWriter *stream, size_t n) {
+    if (stream->used + n > STREAM_BUFFER_SIZE) {
+        flushStream(stream);
+    }
+}
+
+static void putChar(StreamWriter *stream, char c) {
+    reserve(stream, 1);
+    stream->buffer[stream->used++] = c;
+}
+
+static void putText(StreamWriter *stream, const char *text) {
+    size_t length = strlen(text);
+    reserve(stream, length);
+    if (length > STREAM_BUFFER_SIZE) {
+        fwrite(text, 1, length, stream->out);
+        return;
+    }
+    memcpy(stream->buffer + stream->used, text, length);
+    stream->used += length;
+}
+
+static void putLong(StreamWriter *stream, long value) {
+    char digits[24];
+    int count = 0;
+    unsigned long magnitude = (value < 0) ? -(unsigned long)value : (unsigned long)value;
+
+    // Digits come out last-first
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    reserve(stream, count + 1);
+    if (value < 0) {
+        stream->buffer[stream->used++] = '-';
+    }
+    while (count > 0) {
+        stream->buffer[stream->used++] = digits[--count];
+    }
+}
+
+// value / 10^places with exactly 'places' decimals: 1234, 2 → "12.34"
+static void putFixed(StreamWriter *stream, long value, int places) {
+    long scale = 1;
+    for (int i = 0; i < places; i++) {
+        scale *= 10;
+    }
+    putLong(stream, value / scale);
+    putChar(stream, '.');
+
+    long fraction = value % scale;
+    for (scale /= 10; scale > 0; scale /= 10) {
+        putChar(stream, (char)('0' + fraction / scale));
+        fraction %= scale;
+    }
+}
+
+// Simulated time with 3 decimals, or "null" / an empty CSV cell
+static void putTime(StreamWriter *stream, double time) {
+    if (time < 0) {
+        if (stream->format == STREAM_NDJSON) {
+            putText(stream, "null");
+        }
+        return;
+    }
+    putFixed(stream, (long)(time * 1000 + 0.5), 3);
+}
+
+// An int field where -1 means "does not apply"
+static void putOptional(StreamWriter *stream, int value) {
+    if (value == -1) {
+        if (stream->format == STREAM_NDJSON) {
+            putText(stream, "null");
+        }
+        return;
+    }
+    putLong(stream, value);
+}
+
+// JSON: "name" or null; CSV: the bare word or an empty cell
+static void putWord(StreamWriter *stream, const char *word) {
+    if (word == NULL) {
+        if (stream->format == STREAM_NDJSON) {
+            putText(stream, "null");
+        }
+        return;
+    }
+    if (stream->format == STREAM_NDJSON) {
+        putChar(stream, '"');
+        putText(stream, word);
+        putChar(stream, '"');
+    } else {
+        putText(stream, word);
+    }
+}
+
+// Every record ends here: newline, count it
+static void endRecord(StreamWriter *stream) {
+    putChar(stream, '\n');
+    stream->records++;
+}
+
+
+/*
+================================================================================
+TOTALS (internal helper)
+================================================================================
+Fragmentation uses the same formula as calculateFragmentation(), in
+hundredths of a percent, rounded.
+
+JSON: ,"processes":1,"holes":1,"free":668,"largest":668,"fragmentation":0.00
+CSV:  1,1,668,668,0.00
+*/
+
+static void putTotals(StreamWriter *stream, MemoryManager *mm) {
+    int largest = largestHoleSize(mm);
+    long hundredths = 0;
+    if (mm->freeMemory > 0 && mm->userMemory > 0) {
+        hundredths = ((long)(mm->freeMemory - largest) * 10000 + mm->userMemory / 2)
+                     / mm->userMemory;
+    }
+
+    int json = (stream->format == STREAM_NDJSON);
+    putText(stream, json ? ",\"processes\":" : "");
+    putLong(stream, mm->numProcesses);
+    putText(stream, json ? ",\"holes\":" : ",");
+    putLong(stream, mm->numHoles);
+    putText(stream, json ? ",\"free\":" : ",");
+    putLong(stream, mm->freeMemory);
+    putText(stream, json ? ",\"largest\":" : ",");
+    putLong(stream, largest);
+    putText(stream, json ? ",\"fragmentation\":" : ",");
+    putFixed(stream, hundredths, 2);
+}
+
+
+/*
+================================================================================
+FUNCTION: openStream / closeStream / flushStream
+================================================================================
+*/
+
+int openStream(StreamWriter *stream, FILE *out, StreamFormat format) {
+    stream->out = out;
+    stream->format = format;
+    stream->used = 0;
+    stream->records = 0;
+    stream->buffer = (char *)malloc(STREAM_BUFFER_SIZE);
+    if (stream->buffer == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    if (format == STREAM_CSV) {
+        putText(stream, "type,seq,time,op,pid,size,address,algo,result,"
+                        "processes,holes,free,largest,fragmentation,message\n");
+    }
+    return 1;
+}
+
+void flushStream(StreamWriter *stream) {
+    if (stream->used > 0) {
+        fwrite(stream->buffer, 1, stream->used, stream->out);
+        stream->used = 0;
+    }
+    fflush(stream->out);
+}
+
+void closeStream(StreamWriter *stream) {
+    if (stream->buffer == NULL) {
+        return;
+    }
+    flushStream(stream);
+    free(stream->buffer);
+    stream->buffer = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: streamEvent
+================================================================================
+*/
+
+void streamEvent(StreamWriter *stream, MemoryManager *mm, const StreamEvent *event) {
+    if (stream->format == STREAM_NDJSON) {
+        putText(stream, "{\"type\":\"event\",\"seq\":");
+        putLong(stream, event->sequence);
+        putText(stream, ",\"time\":");
+        putTime(stream, event->time);
+        putText(stream, ",\"op\":");
+        putWord(stream, event->op);
+        putText(stream, ",\"pid\":");
+        putOptional(stream, event->processID);
+        putText(stream, ",\"size\":");
+        putOptional(stream, event->size);
+        putText(stream, ",\"address\":");
+        putOptional(stream, event->address);
+        putText(stream, ",\"algo\":");
+        putWord(stream, event->algo);
+        putText(stream, event->ok ? ",\"ok\":true" : ",\"ok\":false");
+        putTotals(stream, mm);
+        putChar(stream, '}');
+    } else {
+        putText(stream, "event,");
+        putLong(stream, event->sequence);
+        putChar(stream, ',');
+        putTime(stream, event->time);
+        putChar(stream, ',');
+        putWord(stream, event->op);
+        putChar(stream, ',');
+        putOptional(stream, event->processID);
+        putChar(stream, ',');
+        putOptional(stream, event->size);
+        putChar(stream, ',');
+        putOptional(stream, event->address);
+        putChar(stream, ',');
+        putWord(stream, event->algo);
+        putText(stream, event->ok ? ",ok," : ",fail,");
+        putTotals(stream, mm);
+        putChar(stream, ',');
+    }
+    endRecord(stream);
+}
+
+
+/*
+================================================================================
+FUNCTION: streamState
+================================================================================
+*/
+
+// One block: "[start,size,pid]" inside the NDJSON state (a ',' before
+// all but the first), or one CSV "block" row
+static void putBlock(StreamWriter *stream, long sequence, double time,
+                     long start, long size, long processID, int first) {
+    if (stream->format == STREAM_NDJSON) {
+        putText(stream, first ? "[" : ",[");
+        putLong(stream, start);
+        putChar(stream, ',');
+        putLong(stream, size);
+        putChar(stream, ',');
+        putLong(stream, processID);
+        putChar(stream, ']');
+        return;
+    }
+    putText(stream, "block,");
+    putLong(stream, sequence);
+    putChar(stream, ',');
+    putTime(stream, time);
+    putText(stream, ",,");
+    putLong(stream, processID);
+    putChar(stream, ',');
+    putLong(stream, size);
+    putChar(stream, ',');
+    putLong(stream, start);
+    putText(stream, ",,,,,,,,");
+    endRecord(stream);
+}
+
+// Every block, from the block list or the compact pool. The bitmap
+// backend keeps no blocks - only the totals are written for it
+static void putBlocks(StreamWriter *stream, MemoryManager *mm, long sequence, double time) {
+    if (mm->compactPool != NULL) {
+        CompactPool *pool = mm->compactPool;
+        for (unsigned int i = pool->head; i != COMPACT_NONE; i = pool->blocks[i].next) {
+            CompactBlock *block = &pool->blocks[i];
+            putBlock(stream, sequence, time, block->startAddress, compactBlockSize(block),
+                     block->processID, i == pool->head);
+        }
+        return;
+    }
+
+    MemoryBlock *first = (mm->bitmap != NULL) ? NULL : mm->head;
+    for (MemoryBlock *block = first; block != NULL; block = block->next) {
+        putBlock(stream, sequence, time, block->startAddress, block->size,
+                 block->isHole ? -1 : block->processID, block == first);
+    }
+}
+
+void streamState(StreamWriter *stream, MemoryManager *mm, long sequence, double time) {
+    if (stream->format == STREAM_NDJSON) {
+        putText(stream, "{\"type\":\"state\",\"seq\":");
+        putLong(stream, sequence);
+        putText(stream, ",\"time\":");
+        putTime(stream, time);
+        putTotals(stream, mm);
+
+        // [start, size, pid] per block
+        putText(stream, ",\"blocks\":[");
+        putBlocks(stream, mm, sequence, time);
+        putText(stream, "]}");
+        endRecord(stream);
+        return;
+    }
+
+    // CSV: one row per block, then the totals row
+    putBlocks(stream, mm, sequence, time);
+    putText(stream, "state,");
+    putLong(stream, sequence);
+    putChar(stream, ',');
+    putTime(stream, time);
+    putText(stream, ",,,,,,,");
+    putTotals(stream, mm);
+    putChar(stream, ',');
+    endRecord(stream);
+}
+
+
+/*
+================================================================================
+FUNCTION: streamNote
+================================================================================
+*/
+
+void streamNote(StreamWriter *stream, const char *type, long sequence, const char *message) {
+    if (stream->format == STREAM_NDJSON) {
+        putText(stream, "{\"type\":");
+        putWord(stream, type);
+        putText(stream, ",\"seq\":");
+        putLong(stream, sequence);
+        putText(stream, ",\"message\":");
+        putWord(stream, message);
+        putChar(stream, '}');
+    } else {
+        putText(stream, type);
+        putChar(stream, ',');
+        putLong(stream, sequence);
+        putText(stream, ",,,,,,,,,,,,,");
+        putText(stream, message);
+    }
+    endRecord(stream);
+}
+
+
+/*
+================================================================================
+END OF FILE: stream_output.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. openStream() / closeStream() / flushStream() - 1 MB buffer, CSV header
+2. streamEvent() - One operation + totals, O(1) with a largest-hole index
+3. streamState() - Totals + every block
+4. streamNote() - Error and summary records
+================================================================================
+*/
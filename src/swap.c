@@ -0,0 +1,402 @@
+/*
+================================================================================
+FILE: swap.c
+PURPOSE: Implement swapping to a backing store
+DESCRIPTION:
+    - Victims are found through the BlockIndex (LRU list, size tree and
+      hole heap), never by walking the block list or the PID table
+    - A swapped-out process is only remembered (pid, size); its data
+      is what a real system would write to disk
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/swap.h"
+#include "../include/shared_view.h"
+#include "../include/bitmap_alloc.h"
+
+
+/*
+================================================================================
+FUNCTION: enableSwapping / disableSwapping
+================================================================================
+*/
+
+int enableSwapping(MemoryManager *mm, SwapSpace *swap, SwapPolicy policy) {
+    if (!requireBlockList(mm, "Swapping")) {
+        return 0;
+    }
+
+    // STEP 1: Empty backing store (grows when needed)
+    swap->policy = policy;
+    swap->capacity = 16;
+    swap->numSwapped = 0;
+    swap->swapped = (SwappedProcess *)malloc(sizeof(SwappedProcess) * swap->capacity);
+    if (swap->swapped == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    swap->swapOuts = 0;
+    swap->swapIns = 0;
+    swap->kbOut = 0;
+    swap->kbIn = 0;
+
+    // STEP 2: Victim search needs the PID table and the hole heap
+    swap->ownsIndex = 0;
+    if (mm->blockIndex == NULL) {
+        if (!enableBlockIndex(mm, &swap->index)) {
+            free(swap->swapped);
+            return 0;
+        }
+        swap->ownsIndex = 1;
+    }
+
+    mm->swapSpace = swap;
+    return 1;
+}
+
+void disableSwapping(MemoryManager *mm) {
+    SwapSpace *swap = mm->swapSpace;
+
+    if (swap == NULL) {
+        return;
+    }
+
+    if (swap->ownsIndex) {
+        disableBlockIndex(mm);
+    }
+    free(swap->swapped);
+    swap->swapped = NULL;
+    swap->numSwapped = 0;
+    mm->swapSpace = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: spaceFreedBy (internal helper)
+================================================================================
+PURPOSE: Size of the hole that swapping out 'block' would leave
+
+The block itself plus the holes right before and after it (they merge).
+*/
+
+static int spaceFreedBy(MemoryBlock *block) {
+    int space = block->size;
+
+    if (block->prev != NULL && block->prev->isHole) {
+        space += block->prev->size;
+    }
+    if (block->next != NULL && block->next->isHole) {
+        space += block->next->size;
+    }
+    return space;
+}
+
+
+/*
+================================================================================
+FEWEST BYTES (internal helpers)
+================================================================================
+A process that makes the request fit beats one that doesn't; then the
+fewest KB to write wins, or (nothing fits alone) the most space freed.
+
+Instead of looking at every process we look at few candidates:
+1. Any process of at least 'size' KB fits on its own - the smallest
+   such one comes straight from the size tree
+2. A smaller process of s KB only fits with the holes beside it, so one
+   of those holes is at least (size - s) / 2 KB. We walk the hole heap
+   from the top and look at the two neighbours of each hole. A subtree
+   of the heap is skipped once its top hole is too small to help: too
+   small to beat the best fit so far, or (nothing fits yet) too small
+   to free more space than the best candidate so far
+*/
+
+typedef struct VictimSearch {
+    int size;               // The request
+    int largestProcess;     // KB - bounds what a neighbour can add
+    MemoryBlock *victim;
+    int victimSpace;
+    int victimFits;
+} VictimSearch;
+
+static void considerVictim(VictimSearch *search, BlockIndex *index, MemoryBlock *block) {
+    if (block == NULL || block->isHole ||
+        (block->lruOlder == NULL && index->lruOldest != block)) {
+        return;         // A hole, or a segment (not on the victim lists)
+    }
+
+    int space = spaceFreedBy(block);
+    int fits = (space >= search->size);
+    int better;
+
+    if (search->victim == NULL || fits != search->victimFits) {
+        better = (search->victim == NULL) || fits;
+    } else if (fits) {
+        better = (block->size < search->victim->size);
+    } else {
+        better = (space > search->victimSpace);
+    }
+
+    if (better) {
+        search->victim = block;
+        search->victimSpace = space;
+        search->victimFits = fits;
+    }
+}
+
+// Could a process next to a hole of 'holeSize' KB beat the current victim?
+static int holeCanHelp(VictimSearch *search, int holeSize) {
+    if (search->victimFits) {
+        return 2 * holeSize >= search->size - search->victim->size;
+    }
+    return 2 * holeSize + search->largestProcess >= search->victimSpace;
+}
+
+static void searchHoleHeap(VictimSearch *search, BlockIndex *index, int position) {
+    if (position >= index->heapSize) {
+        return;
+    }
+
+    MemoryBlock *hole = index->holeHeap[position];
+    if (search->victim != NULL && !holeCanHelp(search, hole->size)) {
+        return;         // Every hole below is smaller still
+    }
+
+    considerVictim(search, index, hole->prev);
+    considerVictim(search, index, hole->next);
+    searchHoleHeap(search, index, 2 * position + 1);
+    searchHoleHeap(search, index, 2 * position + 2);
+}
+
+static MemoryBlock *fewestBytesVictim(MemoryManager *mm, int size) {
+    BlockIndex *index = mm->blockIndex;
+    MemoryBlock *largest = indexLargestProcess(mm);
+    VictimSearch search = {size, 0, NULL, 0, 0};
+
+    if (largest == NULL) {
+        return NULL;    // Nothing can be swapped out
+    }
+    search.largestProcess = largest->size;
+
+    // STEP 1: Fits on its own - or, if none does, frees the most by itself
+    considerVictim(&search, index, indexSmallestAtLeast(mm, size));
+    considerVictim(&search, index, largest);
+
+    // STEP 2: Processes beside the holes that could still do better
+    searchHoleHeap(&search, index, 0);
+    return search.victim;
+}
+
+
+/*
+================================================================================
+FUNCTION: chooseVictim (internal helper)
+================================================================================
+PURPOSE: Pick the process to swap out for a request of 'size' KB
+
+LRU and largest first are one lookup in the BlockIndex's victim order
+(the LRU list and the size tree). Segments are never on them.
+*/
+
+static MemoryBlock *chooseVictim(MemoryManager *mm, int size) {
+    switch (mm->swapSpace->policy) {
+        case SWAP_LRU:
+            return indexLeastRecentlyUsed(mm);
+        case SWAP_LARGEST_FIRST:
+            return indexLargestProcess(mm);
+        default:
+            return fewestBytesVictim(mm, size);
+    }
+}
+
+
+/*
+================================================================================
+FUNCTION: swapOut (internal helper)
+================================================================================
+PURPOSE: Write one process to the backing store and free its memory
+
+The hole is merged with its neighbours right away (never parked on a
+quick list), so the hole heap sees the full space at once.
+*/
+
+static int swapOut(MemoryManager *mm, MemoryBlock *block) {
+    SwapSpace *swap = mm->swapSpace;
+
+    // STEP 1: Remember it on the backing store
+    if (swap->numSwapped == swap->capacity) {
+        int newCapacity = swap->capacity * 2;
+        SwappedProcess *bigger = (SwappedProcess *)realloc(swap->swapped,
+                                     sizeof(SwappedProcess) * newCapacity);
+        if (bigger == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return 0;
+        }
+        swap->swapped = bigger;
+        swap->capacity = newCapacity;
+    }
+    swap->swapped[swap->numSwapped].processID = block->processID;
+    swap->swapped[swap->numSwapped].size = block->size;
+    swap->numSwapped++;
+
+    // STEP 2: Count the I/O
+    swap->swapOuts++;
+    swap->kbOut += block->size;
+
+    // STEP 3: Free its memory and merge with neighbouring holes
+    unbindBlock(mm, block);
+    if (block->next != NULL && block->next->isHole) {
+        mergeWithNext(mm, block);
+    }
+    if (block->prev != NULL && block->prev->isHole) {
+        mergeWithNext(mm, block->prev);
+    }
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: swapOutFor
+================================================================================
+*/
+
+int swapOutFor(MemoryManager *mm, int size) {
+    int count = 0;
+
+    if (mm->swapSpace == NULL || size > mm->userMemory) {
+        return 0;       // Could never fit, even with memory empty
+    }
+
+    // Each check of "does it fit yet?" is the top of the hole heap
+    while (largestHoleSize(mm) < size) {
+        MemoryBlock *victim = chooseVictim(mm, size);
+        if (victim == NULL || !swapOut(mm, victim)) {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+
+/*
+================================================================================
+FUNCTION: findSwapped (internal helper)
+================================================================================
+PURPOSE: Position of 'processID' on the backing store, or -1
+*/
+
+static int findSwapped(SwapSpace *swap, int processID) {
+    for (int i = 0; i < swap->numSwapped; i++) {
+        if (swap->swapped[i].processID == processID) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Remove entry i (order does not matter - fill the gap with the last one)
+static void removeSwapped(SwapSpace *swap, int i) {
+    swap->swapped[i] = swap->swapped[--swap->numSwapped];
+}
+
+
+/*
+================================================================================
+FUNCTION: swapIn
+================================================================================
+*/
+
+int swapIn(MemoryManager *mm, int processID, AllocationAlgorithm algo) {
+    SwapSpace *swap = mm->swapSpace;
+
+    // STEP 1: Is it on the backing store?
+    int i = (swap != NULL) ? findSwapped(swap, processID) : -1;
+    if (i == -1) {
+        if (isVerbose()) {
+            printf("Error: P%d is not swapped out!\n", processID);
+        }
+        return -1;
+    }
+
+    // STEP 2: Take it off first - making room may swap others out
+    SwappedProcess entry = swap->swapped[i];
+    removeSwapped(swap, i);
+
+    // STEP 3: Place it like a new request (any address will do)
+    int address = allocateMemory(mm, entry.processID, entry.size, algo);
+    if (address == -1) {
+        swap->swapped[swap->numSwapped++] = entry;     // Still on disk
+        return -1;
+    }
+
+    // STEP 4: Count the I/O
+    swap->swapIns++;
+    swap->kbIn += entry.size;
+    return address;
+}
+
+
+/*
+================================================================================
+FUNCTION: isSwapped / discardSwapped
+================================================================================
+*/
+
+int isSwapped(MemoryManager *mm, int processID) {
+    return mm->swapSpace != NULL && findSwapped(mm->swapSpace, processID) != -1;
+}
+
+int discardSwapped(MemoryManager *mm, int processID) {
+    if (mm->swapSpace == NULL) {
+        return 0;
+    }
+
+    int i = findSwapped(mm->swapSpace, processID);
+    if (i == -1) {
+        return 0;
+    }
+    removeSwapped(mm->swapSpace, i);
+    return 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: displaySwapStats
+================================================================================
+*/
+
+void displaySwapStats(MemoryManager *mm) {
+    SwapSpace *swap = mm->swapSpace;
+    const char *names[] = {"LRU", "largest first", "fewest bytes"};
+
+    if (swap == NULL) {
+        printf("Swapping is off.\n");
+        return;
+    }
+
+    printf("Swapping (%s): %d processes on backing store\n",
+           names[swap->policy], swap->numSwapped);
+    printf("Swap-outs: %d (%ld KB) | Swap-ins: %d (%ld KB)\n",
+           swap->swapOuts, swap->kbOut, swap->swapIns, swap->kbIn);
+}
+
+
+/*
+================================================================================
+END OF FILE: swap.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableSwapping() / disableSwapping() - Attach store (+ BlockIndex)
+2. chooseVictim() - LRU list / size tree / pruned hole heap walk
+3. swapOutFor() / swapOut() - Evict until the hole heap says it fits
+4. swapIn() / isSwapped() / discardSwapped()
+5. displaySwapStats() - Swap I/O counters
+================================================================================
+*/
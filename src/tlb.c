@@ -0,0 +1,271 @@
+/*
+================================================================================
+FILE: tlb.c
+PURPOSE: Implement the set-associative TLB and the page walk cost model
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/tlb.h"
+
+
+/*
+================================================================================
+FUNCTION: pageWalkLevels
+================================================================================
+*/
+
+int pageWalkLevels(const WalkCostModel *cost, int pageSize) {
+
+    // Offset bits = log2(pageSize), rounded up
+    int offsetBits = 0;
+    while ((1 << offsetBits) < pageSize) {
+        offsetBits++;
+    }
+
+    int remaining = cost->addressBits - offsetBits;
+    int levels = (remaining + cost->bitsPerLevel - 1) / cost->bitsPerLevel;
+    return (levels > 0) ? levels : 1;
+}
+
+
+/*
+================================================================================
+FUNCTION: initTranslationModel / freeTranslationModel
+================================================================================
+*/
+
+int initTranslationModel(TranslationModel *tm, PagingSystem *ps,
+                         const TLBConfig configs[], int numConfigs,
+                         WalkCostModel cost) {
+
+    // STEP 1: The TLB entries for this page size
+    const TLBConfig *config = NULL;
+    for (int i = 0; i < numConfigs; i++) {
+        if (configs[i].pageSize <= ps->pageSize &&
+            (config == NULL || configs[i].pageSize > config->pageSize)) {
+            config = &configs[i];
+        }
+    }
+    if (config == NULL || config->numSets <= 0 || config->ways <= 0) {
+        printf("Error: No TLB configuration for %d KB pages!\n", ps->pageSize);
+        return 0;
+    }
+
+    // STEP 2: Empty TLB
+    int slots = config->numSets * config->ways;
+    tm->tlb.pageSize = ps->pageSize;
+    tm->tlb.numSets = config->numSets;
+    tm->tlb.ways = config->ways;
+    tm->tlb.keys = (unsigned long long *)calloc(slots, sizeof(unsigned long long));
+    tm->tlb.lastUse = (unsigned int *)calloc(slots, sizeof(unsigned int));
+    tm->tlb.now = 0;
+    tm->tlb.hits = 0;
+    tm->tlb.misses = 0;
+    if (tm->tlb.keys == NULL || tm->tlb.lastUse == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(tm->tlb.keys);
+        free(tm->tlb.lastUse);
+        return 0;
+    }
+
+    // STEP 3: Walk cost for this page size
+    tm->paging = ps;
+    tm->cost = cost;
+    tm->walkLevels = pageWalkLevels(&cost, ps->pageSize);
+
+    tm->accesses = 0;
+    tm->invalid = 0;
+    tm->walkCycles = 0;
+    tm->totalCycles = 0;
+    return 1;
+}
+
+void freeTranslationModel(TranslationModel *tm) {
+    free(tm->tlb.keys);
+    free(tm->tlb.lastUse);
+    tm->tlb.keys = NULL;
+    tm->tlb.lastUse = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: tlbLookup (internal helper)
+================================================================================
+PURPOSE: 1 on a hit; on a miss the translation is loaded (LRU slot of
+its set) and 0 is returned
+*/
+
+static int tlbLookup(TLB *tlb, int processID, int page) {
+    unsigned long long key = (((unsigned long long)(unsigned int)processID << 32) |
+                              (unsigned int)page) + 1;
+    int set = (int)((unsigned int)(page ^ (processID * 0x9E3779B1u)) % tlb->numSets);
+    int first = set * tlb->ways;
+    int victim = first;
+
+    tlb->now++;
+    for (int slot = first; slot < first + tlb->ways; slot++) {
+        if (tlb->keys[slot] == key) {
+            tlb->lastUse[slot] = tlb->now;
+            tlb->hits++;
+            return 1;
+        }
+        if (tlb->lastUse[slot] < tlb->lastUse[victim]) {
+            victim = slot;
+        }
+    }
+
+    tlb->keys[victim] = key;
+    tlb->lastUse[victim] = tlb->now;
+    tlb->misses++;
+    return 0;
+}
+
+
+/*
+================================================================================
+FUNCTION: translateAccess
+================================================================================
+*/
+
+int translateAccess(TranslationModel *tm, int processID, int logicalAddress) {
+
+    // STEP 1: The page table decides whether the address is valid
+    int physical = translateAddress(tm->paging, processID, logicalAddress);
+    if (physical == -1) {
+        tm->invalid++;
+        return -1;
+    }
+
+    // STEP 2: TLB first; a miss costs one read per page table level
+    tm->accesses++;
+    tm->totalCycles += tm->cost.tlbHitCycles;
+    if (!tlbLookup(&tm->tlb, processID, logicalAddress / tm->paging->pageSize)) {
+        long long walk = (long long)tm->walkLevels * tm->cost.cyclesPerLevel;
+        tm->walkCycles += walk;
+        tm->totalCycles += walk;
+    }
+    return physical;
+}
+
+
+/*
+================================================================================
+FUNCTION: displayTranslationStats
+================================================================================
+*/
+
+void displayTranslationStats(TranslationModel *tm) {
+    long long lookups = tm->tlb.hits + tm->tlb.misses;
+    double hitRate = (lookups > 0) ? (double)tm->tlb.hits / lookups * 100 : 0.0;
+    double perAccess = (tm->accesses > 0) ? (double)tm->walkCycles / tm->accesses : 0.0;
+    double total = (tm->accesses > 0) ? (double)tm->totalCycles / tm->accesses : 0.0;
+
+    printf("%d KB pages, %d-level walk, TLB %d sets x %d ways\n",
+           tm->paging->pageSize, tm->walkLevels, tm->tlb.numSets, tm->tlb.ways);
+    printf("TLB hit rate: %.2f%% | Avg walk cost: %.2f cycles/access | Avg total: %.2f\n",
+           hitRate, perAccess, total);
+}
+
+
+/*
+================================================================================
+FUNCTION: compareHugePages
+================================================================================
+*/
+
+// xorshift32 - same sequence for the same seed on every page size
+static unsigned int nextRandom(unsigned int *state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+void compareHugePages(const MemoryManager *mm, const int sizes[], int n,
+                      const TLBConfig configs[], int numConfigs,
+                      WalkCostModel cost, long long numAccesses, unsigned int seed) {
+
+    int *cursor = (int *)malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (cursor == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return;
+    }
+
+    printf("%-9s %-9s %-10s %-13s %s\n",
+           "Page", "Frag", "TLB hits", "Walk/access", "Cycles/access");
+
+    for (int c = 0; c < numConfigs; c++) {
+
+        // STEP 1: Page the workload with this page size
+        PagingSystem ps;
+        TranslationModel tm;
+        if (!initPaging(&ps, mm, configs[c].pageSize)) {
+            continue;
+        }
+        for (int i = 0; i < n; i++) {
+            pagingAllocate(&ps, i + 1, sizes[i]);
+        }
+        if (!initTranslationModel(&tm, &ps, configs, numConfigs, cost)) {
+            freePaging(&ps);
+            continue;
+        }
+
+        // STEP 2: Accesses with locality - mostly small steps inside
+        // one process, sometimes a jump or a switch to another process
+        unsigned int state = (seed != 0) ? seed : 1;
+        int current = 0;
+        for (int i = 0; i < n; i++) {
+            cursor[i] = 0;
+        }
+        for (long long a = 0; a < numAccesses && n > 0; a++) {
+            unsigned int r = nextRandom(&state);
+            if (r % 100 == 0) {
+                current = (int)(nextRandom(&state) % n);
+            }
+            if (r % 10 == 0) {
+                cursor[current] = (int)(nextRandom(&state) % sizes[current]);
+            } else {
+                cursor[current] = (cursor[current] + (int)(r >> 8) % 4) % sizes[current];
+            }
+            translateAccess(&tm, current + 1, cursor[current]);
+        }
+
+        // STEP 3: One row
+        long long lookups = tm.tlb.hits + tm.tlb.misses;
+        char page[16], frag[16], hits[16];
+        snprintf(page, sizeof(page), "%d KB", ps.pageSize);
+        snprintf(frag, sizeof(frag), "%.2f%%", pagingFragmentation(&ps));
+        snprintf(hits, sizeof(hits), "%.2f%%",
+                 (lookups > 0) ? (double)tm.tlb.hits / lookups * 100 : 0.0);
+        printf("%-9s %-9s %-10s %-13.2f %.2f\n", page, frag, hits,
+               (tm.accesses > 0) ? (double)tm.walkCycles / tm.accesses : 0.0,
+               (tm.accesses > 0) ? (double)tm.totalCycles / tm.accesses : 0.0);
+        if (tm.invalid > 0) {
+            printf("          (%lld accesses to processes that did not fit)\n", tm.invalid);
+        }
+
+        freeTranslationModel(&tm);
+        freePaging(&ps);
+    }
+
+    free(cursor);
+}
+
+
+/*
+================================================================================
+END OF FILE: tlb.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. pageWalkLevels() - Levels from address bits, page size, bits/level
+2. tlbLookup() - Set-associative, LRU within a set
+3. translateAccess() - Page table check + TLB + walk cost
+4. displayTranslationStats() / compareHugePages()
+================================================================================
+*/
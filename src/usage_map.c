@@ -0,0 +1,299 @@
+/*
+================================================================================
+FILE: usage_map.c
+PURPOSE: Implement the used-KB sum tree and the to-scale memory bar
+================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/usage_map.h"
+#include "../include/bitmap_alloc.h"
+#include "../include/compact_blocks.h"
+
+
+/*
+================================================================================
+BUCKET HELPERS (internal)
+================================================================================
+*/
+
+static int bucketStart(UsageMap *map, int bucket) {
+    return map->baseAddress + bucket * map->bucketSize;
+}
+
+// Real width of a bucket - the last one may stop at the end of memory
+static int bucketWidth(UsageMap *map, int bucket) {
+    int start = bucketStart(map, bucket);
+    int end = start + map->bucketSize;
+    return ((end < map->endAddress) ? end : map->endAddress) - start;
+}
+
+// Add 'delta' * overlap to every bucket that [start, end) touches
+static void addToBuckets(UsageMap *map, int start, int end, int delta) {
+    int first = (start - map->baseAddress) / map->bucketSize;
+    int last = (end - 1 - map->baseAddress) / map->bucketSize;
+
+    for (int b = first; b <= last; b++) {
+        int lo = bucketStart(map, b);
+        int hi = lo + map->bucketSize;
+        if (lo < start) {
+            lo = start;
+        }
+        if (hi > end) {
+            hi = end;
+        }
+        map->used[map->numBuckets + b] += (long)delta * (hi - lo);
+    }
+}
+
+// Recompute the sums above buckets first..last, one level at a time
+static void refreshParents(UsageMap *map, int first, int last) {
+    int lo = (map->numBuckets + first) / 2;
+    int hi = (map->numBuckets + last) / 2;
+
+    while (lo >= 1) {
+        for (int i = lo; i <= hi; i++) {
+            map->used[i] = map->used[2 * i] + map->used[2 * i + 1];
+        }
+        lo /= 2;
+        hi /= 2;
+    }
+}
+
+// Sum of whole buckets first..last (inclusive) - classic bottom-up query
+static long sumBuckets(UsageMap *map, int first, int last) {
+    long total = 0;
+    int lo = map->numBuckets + first;
+    int hi = map->numBuckets + last + 1;
+
+    while (lo < hi) {
+        if (lo & 1) {
+            total += map->used[lo++];
+        }
+        if (hi & 1) {
+            total += map->used[--hi];
+        }
+        lo /= 2;
+        hi /= 2;
+    }
+    return total;
+}
+
+
+/*
+================================================================================
+FUNCTION: enableUsageMap / disableUsageMap
+================================================================================
+*/
+
+int enableUsageMap(MemoryManager *mm, UsageMap *map, int maxBuckets) {
+
+    // STEP 1: Bucket size - as small as the bucket budget allows
+    if (maxBuckets < 1 || maxBuckets > USAGE_MAP_MAX_BUCKETS) {
+        maxBuckets = USAGE_MAP_MAX_BUCKETS;
+    }
+    map->baseAddress = mm->osMemory;
+    map->endAddress = mm->totalMemory;
+    map->bucketSize = (mm->userMemory + maxBuckets - 1) / maxBuckets;
+    if (map->bucketSize < 1) {
+        map->bucketSize = 1;
+    }
+
+    int needed = (mm->userMemory + map->bucketSize - 1) / map->bucketSize;
+    map->numBuckets = 1;
+    while (map->numBuckets < needed) {
+        map->numBuckets *= 2;
+    }
+
+    map->used = (long *)calloc(2 * map->numBuckets, sizeof(long));
+    if (map->used == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    // STEP 2: Fill the buckets from what is in memory now
+    if (mm->bitmap != NULL) {
+        BitmapBackend *bb = mm->bitmap;
+        for (int i = 0; i < bb->tableCapacity; i++) {
+            if (bb->table[i].processID != -1) {
+                int start = bb->baseAddress + bb->table[i].firstUnit * bb->unitSize;
+                addToBuckets(map, start, start + bb->table[i].numUnits * bb->unitSize, 1);
+            }
+        }
+    } else if (mm->compactPool != NULL) {
+        CompactPool *pool = mm->compactPool;
+        for (unsigned int i = pool->head; i != COMPACT_NONE; i = pool->blocks[i].next) {
+            if (!compactBlockIsHole(&pool->blocks[i])) {
+                int start = (int)pool->blocks[i].startAddress;
+                addToBuckets(map, start, start + compactBlockSize(&pool->blocks[i]), 1);
+            }
+        }
+    } else {
+        for (MemoryBlock *block = mm->head; block != NULL; block = block->next) {
+            if (!block->isHole) {
+                addToBuckets(map, block->startAddress, block->endAddress + 1, 1);
+            }
+        }
+    }
+
+    // STEP 3: Every sum above the buckets, bottom-up
+    for (int i = map->numBuckets - 1; i >= 1; i--) {
+        map->used[i] = map->used[2 * i] + map->used[2 * i + 1];
+    }
+
+    mm->usageMap = map;
+    return 1;
+}
+
+void disableUsageMap(MemoryManager *mm) {
+    if (mm->usageMap == NULL) {
+        return;
+    }
+    free(mm->usageMap->used);
+    mm->usageMap->used = NULL;
+    mm->usageMap = NULL;
+}
+
+
+/*
+================================================================================
+FUNCTION: usageMapUpdate
+================================================================================
+*/
+
+void usageMapUpdate(MemoryManager *mm, int start, int size, int delta) {
+    UsageMap *map = mm->usageMap;
+    if (map == NULL || size <= 0) {
+        return;
+    }
+
+    addToBuckets(map, start, start + size, delta);
+    refreshParents(map, (start - map->baseAddress) / map->bucketSize,
+                   (start + size - 1 - map->baseAddress) / map->bucketSize);
+}
+
+
+/*
+================================================================================
+FUNCTION: usedInRange
+================================================================================
+PURPOSE: Whole buckets from the tree, the two partial ends in proportion
+
+EXAMPLE: buckets of 192 KB, range 300-700
+[256 ... 447] partial: 148 of 192 KB
+[448 ... 639] whole
+[640 ... 831] partial: 61 of 192 KB
+*/
+
+// Used KB times 'scale': the partial buckets are scaled BEFORE dividing,
+// so a zoomed-in column narrower than a bucket doesn't round down to 0
+static long usedScaled(UsageMap *map, int from, int to, long scale) {
+    long total = 0;
+
+    // The OS region is always in use
+    if (from < map->baseAddress) {
+        int osEnd = (to < map->baseAddress) ? to : map->baseAddress;
+        total += (osEnd - from) * scale;
+        from = map->baseAddress;
+    }
+    if (to > map->endAddress) {
+        to = map->endAddress;
+    }
+    if (from >= to) {
+        return total;
+    }
+
+    int first = (from - map->baseAddress) / map->bucketSize;
+    int last = (to - 1 - map->baseAddress) / map->bucketSize;
+    long firstUsed = map->used[map->numBuckets + first];
+
+    if (first == last) {
+        return total + firstUsed * (to - from) * scale / bucketWidth(map, first);
+    }
+
+    int firstEnd = bucketStart(map, first) + bucketWidth(map, first);
+    total += firstUsed * (firstEnd - from) * scale / bucketWidth(map, first);
+    total += map->used[map->numBuckets + last] * (to - bucketStart(map, last)) * scale
+           / bucketWidth(map, last);
+    if (last > first + 1) {
+        total += sumBuckets(map, first + 1, last - 1) * scale;
+    }
+    return total;
+}
+
+long usedInRange(UsageMap *map, int from, int to) {
+    return usedScaled(map, from, to, 1);
+}
+
+
+/*
+================================================================================
+FUNCTION: renderUsage / drawUsageBar
+================================================================================
+*/
+
+int renderUsage(UsageMap *map, int from, int to, int columns, int *perMille) {
+    if (from < 0 || to > map->endAddress || from >= to || columns <= 0) {
+        return 0;
+    }
+
+    // Never more columns than KB - each column must cover something
+    if (columns > to - from) {
+        columns = to - from;
+    }
+
+    long span = to - from;
+    for (int c = 0; c < columns; c++) {
+        int lo = from + (int)(span * c / columns);
+        int hi = from + (int)(span * (c + 1) / columns);
+        perMille[c] = (int)(usedScaled(map, lo, hi, 1000) / (hi - lo));
+    }
+    return columns;
+}
+
+void drawUsageBar(UsageMap *map, int from, int to, int columns) {
+    int *perMille = (int *)malloc(sizeof(int) * (columns > 0 ? columns : 1));
+    if (perMille == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return;
+    }
+
+    int drawn = renderUsage(map, from, to, columns, perMille);
+    if (drawn == 0) {
+        printf("Error: Invalid range %d-%d!\n", from, to);
+        free(perMille);
+        return;
+    }
+
+    printf("%d [", from);
+    for (int c = 0; c < drawn; c++) {
+        if (perMille[c] == 0) {
+            printf("·");
+        } else if (perMille[c] < 500) {
+            printf("░");
+        } else if (perMille[c] < 1000) {
+            printf("▓");
+        } else {
+            printf("█");
+        }
+    }
+    printf("] %d\n", to - 1);
+    printf("     █ used  ▓ mostly used  ░ mostly free  · free\n");
+    free(perMille);
+}
+
+
+/*
+================================================================================
+END OF FILE: usage_map.c
+================================================================================
+
+WHAT WE IMPLEMENTED:
+1. enableUsageMap() / disableUsageMap() - Buckets + sum tree from the blocks
+2. usageMapUpdate() - Keep the sums right when a block changes owner
+3. usedInRange() - Used KB in any address range, O(log buckets)
+4. renderUsage() - One fill level per column, for the terminal and the UI
+5. drawUsageBar() - To-scale bar with zoom / pan by address range
+================================================================================
+*/
@@ -0,0 +1,279 @@
+/*
+================================================================================
+FILE: wasm_bindings.c
+PURPOSE: Thin WebAssembly interface to the C allocation core
+DESCRIPTION:
+    - Lets the React UI ("UI for MAV") run memory_manager.c directly
+      instead of its own JavaScript copy of the algorithms
+    - Only compiled by Emscripten (see "npm run build:wasm" in the UI),
+      the normal gcc build does not need this file
+    - Every function takes a session pointer, so the UI can run several
+      independent memories at once (the comparison modal does this)
+================================================================================
+*/
+
+#include <stdlib.h>
+#include "../include/memory_manager.h"
+#include "../include/event_log.h"
+#include "../include/address_index.h"
+#include "../include/usage_map.h"
+
+// EMSCRIPTEN_KEEPALIVE tells the compiler "JavaScript calls this, don't
+// remove it". With a normal compiler the macro is simply empty.
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#define WASM_EXPORT EMSCRIPTEN_KEEPALIVE
+#else
+#define WASM_EXPORT
+#endif
+
+// Keyframe interval for the timeline (same as CONFIG.KEYFRAME_INTERVAL)
+#define WASM_KEYFRAME_INTERVAL 32
+
+
+/*
+================================================================================
+STRUCTURE: WasmSession
+================================================================================
+PURPOSE: Everything one UI memory needs, in one heap allocation
+
+- mm: the real MemoryManager
+- log: event log used by the timeline (rewind = rebuildFromEventLog)
+- blockTable: flat int array the UI reads blocks from, 3 ints per block
+  [startAddress, size, processID or -1]
+- addresses: address index, so hover / click lookups are O(log n)
+- usage / usageColumns: used-KB sum tree and the per-column fill levels
+  mav_usage() last wrote (CityViewport draws huge heaps from these)
+*/
+
+typedef struct WasmSession {
+    MemoryManager mm;
+    EventLog log;
+    AddressIndex addresses;
+    UsageMap usage;
+    int *usageColumns;
+    int usageCapacity;
+    int usageCount;
+    int *blockTable;
+    int blockTableCapacity;
+    int blockCount;
+} WasmSession;
+
+
+/*
+--------------------------------------------------------------------------------
+SESSION LIFETIME
+--------------------------------------------------------------------------------
+*/
+
+WASM_EXPORT WasmSession *mav_create(int totalMem, int osMem) {
+    WasmSession *session = (WasmSession *)malloc(sizeof(WasmSession));
+    if (session == NULL) {
+        return NULL;
+    }
+
+    initializeMemory(&session->mm, totalMem, osMem);
+    initEventLog(&session->log, WASM_KEYFRAME_INTERVAL);
+    attachEventLog(&session->mm, &session->log);
+    enableAddressIndex(&session->mm, &session->addresses);
+    enableUsageMap(&session->mm, &session->usage, USAGE_MAP_MAX_BUCKETS);
+    session->usageColumns = NULL;
+    session->usageCapacity = 0;
+    session->usageCount = 0;
+    session->blockTable = NULL;
+    session->blockTableCapacity = 0;
+    session->blockCount = 0;
+    return session;
+}
+
+WASM_EXPORT void mav_destroy(WasmSession *session) {
+    freeMemoryManager(&session->mm);
+    freeEventLog(&session->log);
+    free(session->blockTable);
+    free(session->usageColumns);
+    free(session);
+}
+
+WASM_EXPORT void mav_reset(WasmSession *session) {
+    int totalMem = session->mm.totalMemory;
+    int osMem = session->mm.osMemory;
+
+    freeMemoryManager(&session->mm);
+    freeEventLog(&session->log);
+
+    initializeMemory(&session->mm, totalMem, osMem);
+    attachEventLog(&session->mm, &session->log);
+    enableAddressIndex(&session->mm, &session->addresses);
+    enableUsageMap(&session->mm, &session->usage, USAGE_MAP_MAX_BUCKETS);
+}
+
+
+/*
+--------------------------------------------------------------------------------
+ALLOCATION
+--------------------------------------------------------------------------------
+algo: 0 = FIRST_FIT, 1 = BEST_FIT, 2 = WORST_FIT (same as the C enum)
+*/
+
+WASM_EXPORT int mav_allocate(WasmSession *session, int processID, int size, int algo) {
+    return allocateMemory(&session->mm, processID, size, (AllocationAlgorithm)algo);
+}
+
+WASM_EXPORT int mav_deallocate(WasmSession *session, int processID) {
+    return deallocateMemory(&session->mm, processID);
+}
+
+// Free by start address (like free(ptr)); 1 on success, 0 if no
+// process starts there
+WASM_EXPORT int mav_deallocate_at(WasmSession *session, int address) {
+    return deallocateAt(&session->mm, address);
+}
+
+// Who owns 'address'? processID, or -1 for a hole / outside user memory
+WASM_EXPORT int mav_process_at(WasmSession *session, int address) {
+    MemoryBlock *block = findBlockAt(&session->mm, address);
+    return (block != NULL && !block->isHole) ? block->processID : -1;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+TIMELINE
+--------------------------------------------------------------------------------
+The UI remembers mav_event_count() after every action. To go back to an
+action it calls mav_restore() with that number: the C core seeks to the
+nearest keyframe and replays the deltas forward.
+*/
+
+WASM_EXPORT int mav_event_count(WasmSession *session) {
+    return session->log.numEvents;
+}
+
+WASM_EXPORT int mav_restore(WasmSession *session, int eventIndex) {
+    MemoryManager rebuilt;
+
+    if (!rebuildFromEventLog(&session->log, eventIndex, &rebuilt)) {
+        return 0;
+    }
+
+    // Swap in the rebuilt memory and forget the "future" events
+    freeMemoryManager(&session->mm);
+    session->mm = rebuilt;
+    truncateEventLog(&session->log, eventIndex);
+    attachEventLog(&session->mm, &session->log);
+    enableAddressIndex(&session->mm, &session->addresses);
+    enableUsageMap(&session->mm, &session->usage, USAGE_MAP_MAX_BUCKETS);
+    return 1;
+}
+
+
+/*
+--------------------------------------------------------------------------------
+STATE EXPORT
+--------------------------------------------------------------------------------
+mav_block_table() fills the flat table and returns a pointer into wasm
+memory; JavaScript wraps it in an Int32Array without copying block by
+block through function calls. mav_block_count() says how many blocks
+the last fill wrote.
+*/
+
+static int *fillBlockTable(WasmSession *session, MemoryManager *mm) {
+    int count = mm->numProcesses + mm->numHoles;
+
+    if (count * 3 > session->blockTableCapacity) {
+        int *bigger = (int *)realloc(session->blockTable, sizeof(int) * count * 3);
+        if (bigger == NULL) {
+            session->blockCount = 0;
+            return session->blockTable;
+        }
+        session->blockTable = bigger;
+        session->blockTableCapacity = count * 3;
+    }
+
+    int i = 0;
+    MemoryBlock *current = mm->head;
+    while (current != NULL) {
+        session->blockTable[i++] = current->startAddress;
+        session->blockTable[i++] = current->size;
+        session->blockTable[i++] = current->isHole ? -1 : current->processID;
+        current = current->next;
+    }
+
+    session->blockCount = i / 3;
+    return session->blockTable;
+}
+
+WASM_EXPORT int *mav_block_table(WasmSession *session) {
+    return fillBlockTable(session, &session->mm);
+}
+
+// Same table, but for an earlier point on the timeline (state unchanged)
+WASM_EXPORT int *mav_block_table_at(WasmSession *session, int eventIndex) {
+    MemoryManager past;
+
+    if (!rebuildFromEventLog(&session->log, eventIndex, &past)) {
+        session->blockCount = 0;
+        return session->blockTable;
+    }
+
+    int *table = fillBlockTable(session, &past);
+    freeMemoryManager(&past);
+    return table;
+}
+
+WASM_EXPORT int mav_block_count(WasmSession *session) {
+    return session->blockCount;
+}
+
+WASM_EXPORT int mav_free_memory(WasmSession *session) {
+    return session->mm.freeMemory;
+}
+
+WASM_EXPORT float mav_fragmentation(WasmSession *session) {
+    return calculateFragmentation(&session->mm);
+}
+
+
+/*
+--------------------------------------------------------------------------------
+LEVEL OF DETAIL
+--------------------------------------------------------------------------------
+mav_usage() splits [from, to) into 'columns' slices and returns how full
+each one is (0-1000), read through HEAP32 like the block table. The cost
+depends on the column count, not the block count, so the viewport can
+zoom and pan over a million blocks. Returns NULL on a bad range;
+mav_usage_count() says how many columns were written.
+*/
+
+WASM_EXPORT int *mav_usage(WasmSession *session, int from, int to, int columns) {
+    if (columns > session->usageCapacity) {
+        int *bigger = (int *)realloc(session->usageColumns, sizeof(int) * columns);
+        if (bigger == NULL) {
+            session->usageCount = 0;
+            return NULL;
+        }
+        session->usageColumns = bigger;
+        session->usageCapacity = columns;
+    }
+
+    session->usageCount = renderUsage(&session->usage, from, to, columns,
+                                      session->usageColumns);
+    return (session->usageCount > 0) ? session->usageColumns : NULL;
+}
+
+WASM_EXPORT int mav_usage_count(WasmSession *session) {
+    return session->usageCount;
+}
+
+
+/*
+================================================================================
+END OF FILE: wasm_bindings.c
+================================================================================
+
+BUILD (from the "UI for MAV" folder):
+    npm run build:wasm
+This writes public/wasm/mav_core.js + mav_core.wasm, which
+src/models/WasmMemoryManager.js loads at runtime.
+================================================================================
+*/